@@ -85,6 +85,7 @@ void QGraphPointAnimation::animate()
     default:
     case QGraphTransition::TransitionType::PointAdded: {
         pointList.append(series->points().size() >= 1 ? pointList.last() : m_newPoint);
+        series->d_func()->markPointsChanged();
 
         auto startv = QVariant::fromValue(pointList.last());
         auto endv = QVariant::fromValue(m_newPoint);
@@ -130,15 +131,18 @@ void QGraphPointAnimation::end()
     default:
     case QGraphTransition::TransitionType::PointAdded: {
         points.replace(m_activePointIndex, qvariant_cast<QPointF>(endValue()));
+        series->d_func()->markPointsChanged();
         emit series->pointAdded(points.size() - 1);
         emit series->countChanged();
     } break;
     case QGraphTransition::TransitionType::PointReplaced: {
         points.replace(m_activePointIndex, qvariant_cast<QPointF>(endValue()));
+        series->d_func()->markPointsChanged();
         emit series->pointReplaced(m_activePointIndex);
     } break;
     case QGraphTransition::TransitionType::PointRemoved: {
         points.remove(points.size() - 1);
+        series->d_func()->markPointsChanged();
         emit series->countChanged();
         emit series->pointRemoved(points.size() - 1);
     } break;
@@ -172,5 +176,6 @@ void QGraphPointAnimation::valueUpdated(const QVariant &value)
     } break;
     }
 
+    series->d_func()->markPointsChanged();
     emit series->update();
 }
@@ -165,14 +165,16 @@ QT_BEGIN_NAMESPACE
 */
 
 QAreaSeries::QAreaSeries(QObject *parent)
-    : QAbstractSeries(*(new QAreaSeriesPrivate()), parent)
+    : QAreaSeries(*(new QAreaSeriesPrivate()), parent)
 {}
 
 QAreaSeries::~QAreaSeries() {}
 
 QAreaSeries::QAreaSeries(QAreaSeriesPrivate &dd, QObject *parent)
     : QAbstractSeries(dd, parent)
-{}
+{
+    QObject::connect(this, &QAreaSeries::selectedChanged, this, &QAbstractSeries::update);
+}
 
 QAbstractSeries::SeriesType QAreaSeries::type() const
 {
@@ -0,0 +1,132 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <private/datetimeticks_p.h>
+#include <QtCore/qmath.h>
+
+QT_BEGIN_NAMESPACE
+
+// Steps of calendar aligned date-time ticks. The smallest step which divides the range
+// into at most maxDateTimeDivisions parts is used.
+static constexpr qint64 msecsPerSecond = 1000;
+static constexpr qint64 msecsPerMinute = 60 * msecsPerSecond;
+static constexpr qint64 msecsPerHour = 60 * msecsPerMinute;
+static constexpr qint64 msecsPerDay = 24 * msecsPerHour;
+static constexpr double msecsPerMonth = 30.436875 * msecsPerDay;
+static constexpr qint64 fixedDateTimeSteps[] = {
+    1, 2, 5, 10, 20, 50, 100, 200, 500,
+    msecsPerSecond, 2 * msecsPerSecond, 5 * msecsPerSecond, 10 * msecsPerSecond,
+    15 * msecsPerSecond, 30 * msecsPerSecond,
+    msecsPerMinute, 2 * msecsPerMinute, 5 * msecsPerMinute, 10 * msecsPerMinute,
+    15 * msecsPerMinute, 30 * msecsPerMinute,
+    msecsPerHour, 2 * msecsPerHour, 3 * msecsPerHour, 6 * msecsPerHour, 12 * msecsPerHour,
+    msecsPerDay, 2 * msecsPerDay, 7 * msecsPerDay, 14 * msecsPerDay,
+};
+static constexpr int monthDateTimeSteps[] = { 1, 2, 3, 6, 12 };
+static constexpr int maxDateTimeDivisions = 10;
+
+qint64 DateTimeTicks::msecsAt(qsizetype index) const
+{
+    if (stepMonths > 0)
+        return first.addMonths(int(index * stepMonths)).toMSecsSinceEpoch();
+    if (stepDays > 0)
+        return first.addDays(index * stepDays).toMSecsSinceEpoch();
+    return firstMSecs + qint64(index * stepMSecs);
+}
+
+// Ticks on whole seconds, minutes, hours, days, weeks starting on Monday, months or years
+// of the time zone of min. The ticks of steps shorter than a day are aligned to the start
+// of the day of min, so they stay on the same instants while the range is panned.
+DateTimeTicks DateTimeTicks::calendarTicks(const QDateTime &min, const QDateTime &max)
+{
+    DateTimeTicks ticks;
+    ticks.timeZone = min.timeRepresentation();
+    const qint64 minMSecs = min.toMSecsSinceEpoch();
+    const qint64 maxMSecs = max.toMSecsSinceEpoch();
+    const qint64 range = maxMSecs - minMSecs;
+    if (range <= 0) {
+        ticks.first = min;
+        ticks.firstMSecs = minMSecs;
+        ticks.count = 1;
+        return ticks;
+    }
+
+    // The midnight or first day of a month of the date of max is never after max
+    const QDate maxDate = max.toTimeZone(ticks.timeZone).date();
+    const QDateTime startOfDay(min.date(), QTime(0, 0), ticks.timeZone);
+    for (qint64 step : fixedDateTimeSteps) {
+        if (range / step > maxDateTimeDivisions)
+            continue;
+        ticks.stepMSecs = step;
+        if (step < msecsPerDay) {
+            const qint64 dayMSecs = startOfDay.toMSecsSinceEpoch();
+            ticks.firstMSecs = dayMSecs + qCeil(double(minMSecs - dayMSecs) / step) * step;
+            ticks.first = QDateTime::fromMSecsSinceEpoch(ticks.firstMSecs, ticks.timeZone);
+            ticks.count = ticks.firstMSecs <= maxMSecs
+                              ? (maxMSecs - ticks.firstMSecs) / step + 1
+                              : 0;
+        } else {
+            // Julian day 0 is a Monday, so weeks are aligned to start on Monday
+            ticks.stepDays = int(step / msecsPerDay);
+            qint64 day = min.date().toJulianDay();
+            if (startOfDay < min)
+                ++day;
+            day = qCeil(double(day) / ticks.stepDays) * ticks.stepDays;
+            ticks.first = QDateTime(QDate::fromJulianDay(day), QTime(0, 0), ticks.timeZone);
+            ticks.firstMSecs = ticks.first.toMSecsSinceEpoch();
+            const qint64 maxDay = maxDate.toJulianDay();
+            ticks.count = day <= maxDay ? (maxDay - day) / ticks.stepDays + 1 : 0;
+        }
+        return ticks;
+    }
+
+    int stepMonths = 0;
+    for (int months : monthDateTimeSteps) {
+        if (range / (months * msecsPerMonth) <= maxDateTimeDivisions) {
+            stepMonths = months;
+            break;
+        }
+    }
+    // Multiple years in steps of 1, 2 or 5 times a power of ten
+    for (qint64 years = 1; stepMonths == 0; years *= 10) {
+        for (int factor : { 1, 2, 5 }) {
+            const qint64 months = 12 * factor * years;
+            if (months > 12 && range / (months * msecsPerMonth) <= maxDateTimeDivisions) {
+                stepMonths = int(months);
+                break;
+            }
+        }
+    }
+
+    const QDate minDate = min.date();
+    qint64 month = qint64(minDate.year()) * 12 + minDate.month() - 1;
+    if (QDateTime(QDate(minDate.year(), minDate.month(), 1), QTime(0, 0), ticks.timeZone) < min)
+        ++month;
+    month = qCeil(double(month) / stepMonths) * stepMonths;
+    ticks.first = QDateTime(QDate(int(month / 12), int(month % 12) + 1, 1), QTime(0, 0),
+                            ticks.timeZone);
+    ticks.firstMSecs = ticks.first.toMSecsSinceEpoch();
+    ticks.stepMSecs = stepMonths * msecsPerMonth;
+    ticks.stepMonths = stepMonths;
+
+    const qint64 maxMonth = qint64(maxDate.year()) * 12 + maxDate.month() - 1;
+    ticks.count = month <= maxMonth ? (maxMonth - month) / stepMonths + 1 : 0;
+    return ticks;
+}
+
+// Ticks dividing the range into equal parts
+DateTimeTicks DateTimeTicks::intervalTicks(const QDateTime &min, const QDateTime &max,
+                                           double divisions)
+{
+    DateTimeTicks ticks;
+    ticks.timeZone = min.timeRepresentation();
+    ticks.first = min;
+    ticks.firstMSecs = min.toMSecsSinceEpoch();
+    ticks.stepMSecs = (max.toMSecsSinceEpoch() - ticks.firstMSecs) / divisions;
+    if (qFuzzyIsNull(ticks.stepMSecs))
+        ticks.stepMSecs = 1;
+    ticks.count = qsizetype(divisions + 1);
+    return ticks;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,48 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#ifndef DATETIMETICKS_H
+#define DATETIMETICKS_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the QtGraphs API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+
+#include <QtCore/QDateTime>
+#include <QtCore/QTimeZone>
+#include <QtGraphs/qgraphsglobal.h>
+
+QT_BEGIN_NAMESPACE
+
+// Major ticks of a date-time axis. Steps of days or months are counted in calendar days
+// or months from the first tick, so the ticks stay on midnight and on the first day of
+// a month across daylight saving time changes and months of different lengths.
+// stepMSecs is then the average length of a step.
+struct Q_GRAPHS_EXPORT DateTimeTicks
+{
+    QDateTime first;
+    qint64 firstMSecs = 0;
+    QTimeZone timeZone;
+    double stepMSecs = 1;
+    int stepDays = 0;
+    int stepMonths = 0;
+    qsizetype count = 0;
+
+    qint64 msecsAt(qsizetype index) const;
+    // Whether the steps are counted in calendar days or months, so they can differ in length
+    bool hasCalendarSteps() const { return stepDays > 0 || stepMonths > 0; }
+
+    static DateTimeTicks calendarTicks(const QDateTime &min, const QDateTime &max);
+    static DateTimeTicks intervalTicks(const QDateTime &min, const QDateTime &max,
+                                       double divisions);
+};
+
+QT_END_NAMESPACE
+
+#endif // DATETIMETICKS_H
@@ -88,13 +88,15 @@ QT_BEGIN_NAMESPACE
  \property QDateTimeAxis::tickInterval
  \brief The interval between dynamically placed tick marks and labels.
  The default value is 0, which means that intervals are automatically calculated
- based on the min and max range.
+ based on the min and max range. Automatic intervals are whole seconds, minutes, hours, days,
+ weeks, months or years, and the ticks are placed on their calendar boundaries.
 */
 /*!
  \qmlproperty real DateTimeAxis::tickInterval
  The interval between dynamically placed tick marks and labels.
  The default value is 0, which means that intervals are automatically calculated
- based on the min and max range.
+ based on the min and max range. Automatic intervals are whole seconds, minutes, hours, days,
+ weeks, months or years, and the ticks are placed on their calendar boundaries.
 */
 
 /*!
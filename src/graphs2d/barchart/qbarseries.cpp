@@ -1214,13 +1214,10 @@ qreal QBarSeriesPrivate::minX()
 
     qreal min = INT_MAX;
 
+    // Bars are positioned by their index in the set
     for (int i = 0; i < m_barSets.size(); i++) {
-        qsizetype categoryCount = m_barSets.at(i)->count();
-        for (qsizetype j = 0; j < categoryCount; j++) {
-            qreal temp = m_barSets.at(i)->d_func()->m_values.at(j).x();
-            if (temp < min)
-                min = temp;
-        }
+        if (m_barSets.at(i)->count() > 0)
+            min = 0;
     }
     return min;
 }
@@ -1232,13 +1229,11 @@ qreal QBarSeriesPrivate::maxX()
 
     qreal max = INT_MIN;
 
+    // Bars are positioned by their index in the set
     for (int i = 0; i < m_barSets.size(); i++) {
         qsizetype categoryCount = m_barSets.at(i)->count();
-        for (qsizetype j = 0; j < categoryCount; j++) {
-            qreal temp = m_barSets.at(i)->d_func()->m_values.at(j).x();
-            if (temp > max)
-                max = temp;
-        }
+        if (categoryCount > 0 && categoryCount - 1 > max)
+            max = categoryCount - 1;
     }
 
     return max;
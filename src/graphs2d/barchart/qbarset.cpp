@@ -5,6 +5,8 @@
 #include <private/qbarset_p.h>
 #include <private/charthelpers_p.h>
 
+#include <numeric>
+
 QT_BEGIN_NAMESPACE
 
 /*!
@@ -331,9 +333,8 @@ QString QBarSet::label() const
 void QBarSet::append(qreal value)
 {
     Q_D(QBarSet);
-    // Convert to QPointF
     qsizetype index = d->m_values.size();
-    d->append(QPointF(d->m_values.size(), value));
+    d->append(value);
     emit valuesAdded(index, 1);
     emit update();
 }
@@ -451,7 +452,7 @@ qreal QBarSet::at(qsizetype index) const
     Q_D(const QBarSet);
     if (index < 0 || index >= d->m_values.size())
         return 0;
-    return d->m_values.at(index).y();
+    return d->m_values.at(index);
 }
 
 /*!
@@ -477,10 +478,7 @@ qsizetype QBarSet::count() const
 qreal QBarSet::sum() const
 {
     Q_D(const QBarSet);
-    qreal total(0);
-    for (int i = 0; i < d->m_values.size(); i++)
-        total += d->m_values.at(i).y();
-    return total;
+    return std::accumulate(d->m_values.cbegin(), d->m_values.cend(), qreal(0));
 }
 
 /*!
@@ -693,6 +691,68 @@ void QBarSet::setValues(const QVariantList &values)
         emit valuesChanged();
 }
 
+/*!
+    \since 6.9
+    Returns a read-only view of the values in the bar set, without converting them
+    to QVariant or copying them.
+
+    The view is only valid until the bar set is next modified, so it should not be
+    stored.
+
+    \sa values, at()
+*/
+QSpan<const qreal> QBarSet::valuesSpan() const
+{
+    Q_D(const QBarSet);
+    return d->m_values;
+}
+
+/*!
+    \since 6.9
+    Replaces the values of the bar set with \a values, which can be passed as a
+    QList<qreal> or a braced list as well. NaN and infinite values are ignored.
+
+    Unlike setValues(), this replaces all the values at once and emits
+    valuesChanged() only once, instead of emitting a change, add or remove
+    signal for every value. Selected bars which are still within the bar set stay
+    selected.
+
+    \sa valuesSpan()
+*/
+void QBarSet::replaceValues(QSpan<const qreal> values)
+{
+    Q_D(QBarSet);
+    QList<qreal> newValues;
+    newValues.reserve(values.size());
+    for (const qreal value : values) {
+        if (qIsFinite(value))
+            newValues.append(value);
+    }
+    if (newValues.size() != values.size())
+        qWarning("Ignored NaN, Inf, or -Inf value.");
+
+    if (newValues == d->m_values)
+        return;
+
+    const qsizetype newCount = newValues.size();
+    d->m_values.swap(newValues);
+
+    bool callSignal = false;
+    for (auto it = d->m_selectedBars.begin(); it != d->m_selectedBars.end();) {
+        if (*it >= newCount) {
+            it = d->m_selectedBars.erase(it);
+            callSignal = true;
+        } else {
+            ++it;
+        }
+    }
+
+    emit update();
+    emit valuesChanged();
+    if (callSignal)
+        emit selectedBarsChanged(selectedBars());
+}
+
 
 /*!
     \qmlmethod bool BarSet::isBarSelected(int index)
@@ -899,7 +959,7 @@ QBarSetPrivate::QBarSetPrivate(const QString &label)
 
 QBarSetPrivate::~QBarSetPrivate() {}
 
-void QBarSetPrivate::append(QPointF value)
+void QBarSetPrivate::append(qreal value)
 {
     if (isValidValue(value)) {
         Q_Q(QBarSet);
@@ -908,10 +968,11 @@ void QBarSetPrivate::append(QPointF value)
     }
 }
 
-void QBarSetPrivate::append(const QList<QPointF> &values)
+void QBarSetPrivate::append(QSpan<const qreal> values)
 {
     qsizetype originalIndex = m_values.size();
-    for (const auto &value : values) {
+    m_values.reserve(originalIndex + values.size());
+    for (const auto value : values) {
         if (isValidValue(value))
             m_values.append(value);
     }
@@ -919,28 +980,7 @@ void QBarSetPrivate::append(const QList<QPointF> &values)
     emit q->valueAdded(originalIndex, values.size());
 }
 
-void QBarSetPrivate::append(const QList<qreal> &values)
-{
-    qsizetype originalIndex = m_values.size();
-    qsizetype index = originalIndex;
-    for (const auto value : values) {
-        if (isValidValue(value)) {
-            m_values.append(QPointF(index, value));
-            index++;
-        }
-    }
-    Q_Q(QBarSet);
-    emit q->valueAdded(originalIndex, values.size());
-}
-
 void QBarSetPrivate::insert(qsizetype index, qreal value)
-{
-    m_values.insert(index, QPointF(index, value));
-    Q_Q(QBarSet);
-    emit q->valueAdded(index, 1);
-}
-
-void QBarSetPrivate::insert(qsizetype index, QPointF value)
 {
     m_values.insert(index, value);
     Q_Q(QBarSet);
@@ -956,11 +996,8 @@ qsizetype QBarSetPrivate::remove(qsizetype index, qsizetype count)
     else if ((index + count) > m_values.size())
         removeCount = m_values.size() - index; // Trying to remove more items than list has. Limit amount to be removed.
 
-    int c = 0;
-    while (c < removeCount) {
-        m_values.removeAt(index);
-        c++;
-    }
+    if (removeCount > 0)
+        m_values.remove(index, removeCount);
 
     bool callSignal = false;
     if (!m_selectedBars.empty()) {
@@ -992,21 +1029,14 @@ void QBarSetPrivate::replace(qsizetype index, qreal value)
     if (index < 0 || index >= m_values.size())
         return;
 
-    m_values.replace(index, QPointF(index, value));
-}
-
-qreal QBarSetPrivate::pos(qsizetype index) const
-{
-    if (index < 0 || index >= m_values.size())
-        return 0;
-    return m_values.at(index).x();
+    m_values.replace(index, value);
 }
 
 qreal QBarSetPrivate::value(qsizetype index) const
 {
     if (index < 0 || index >= m_values.size())
         return 0;
-    return m_values.at(index).y();
+    return m_values.at(index);
 }
 
 void QBarSetPrivate::setBarSelected(qsizetype index, bool selected, bool &callSignal)
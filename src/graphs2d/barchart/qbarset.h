@@ -5,6 +5,7 @@
 #define QBARSET_H
 
 #include <QtCore/qobject.h>
+#include <QtCore/qspan.h>
 #include <QtGraphs/qgraphsglobal.h>
 #include <QtGui/qbrush.h>
 #include <QtGui/qfont.h>
@@ -68,6 +69,8 @@ public:
 
     QVariantList values() const;
     void setValues(const QVariantList &values);
+    QSpan<const qreal> valuesSpan() const;
+    void replaceValues(QSpan<const qreal> values);
     qreal borderWidth() const;
     void setBorderWidth(qreal borderWidth);
 
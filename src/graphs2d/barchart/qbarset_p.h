@@ -30,17 +30,14 @@ public:
     QBarSetPrivate(const QString &label);
     ~QBarSetPrivate() override;
 
-    void append(QPointF value);
-    void append(const QList<QPointF> &values);
-    void append(const QList<qreal> &values);
+    void append(qreal value);
+    void append(QSpan<const qreal> values);
 
     void insert(qsizetype index, qreal value);
-    void insert(qsizetype index, QPointF value);
     qsizetype remove(qsizetype index, qsizetype count);
 
     void replace(qsizetype index, qreal value);
 
-    qreal pos(qsizetype index) const;
     qreal value(qsizetype index) const;
 
     void setVisualsDirty(bool dirty) { m_visualsDirty = dirty; }
@@ -53,7 +50,8 @@ public:
 
 public:
     QString m_label;
-    QList<QPointF> m_values;
+    // The value of bar i is m_values[i], bars are positioned by their index
+    QList<qreal> m_values;
     QSet<qsizetype> m_selectedBars;
     // By default colors are transparent, meaning that use the ones from theme
     QColor m_color = QColor(Qt::transparent);
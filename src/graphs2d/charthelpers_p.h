@@ -15,6 +15,9 @@
 
 #include <QtCore/QtNumeric>
 #include <QtCore/QPointF>
+#include <QtCore/QList>
+#include <QtCore/qspan.h>
+#include <QtGui/QTransform>
 
 QT_BEGIN_NAMESPACE
 
@@ -37,6 +40,27 @@ static inline bool isValidValue(QPointF point)
     return (isValidValue(point.x()) && isValidValue(point.y()));
 }
 
+// Maps points with the scale and translation of transform into result, which is resized to
+// the number of points. The loop has no branches or calls, so that the compiler can vectorize
+// it, which makes this much faster than mapping the points one by one.
+static inline void mapPoints(QSpan<const QPointF> points,
+                             const QTransform &transform,
+                             QList<QPointF> &result)
+{
+    Q_ASSERT(transform.type() <= QTransform::TxScale);
+
+    const qreal scaleX = transform.m11();
+    const qreal scaleY = transform.m22();
+    const qreal dx = transform.dx();
+    const qreal dy = transform.dy();
+
+    result.resize(points.size());
+    const QPointF *source = points.data();
+    QPointF *target = result.data();
+    for (qsizetype i = 0; i < points.size(); ++i)
+        target[i] = QPointF(source[i].x() * scaleX + dx, source[i].y() * scaleY + dy);
+}
+
 QT_END_NAMESPACE
 
 #endif // CHARTHELPERS_P_H
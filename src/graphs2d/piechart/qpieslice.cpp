@@ -650,7 +650,6 @@ QPieSlicePrivate::QPieSlicePrivate()
     , m_explodeDistanceFactor(.15)
     , m_labelDirty(false)
     , m_borderWidth(1.0)
-    , m_shapePath(new QQuickShapePath)
     , m_labelItem(new QQuickText)
     , m_labelShape(new QQuickShape)
     , m_labelPath(new QQuickShapePath)
@@ -65,7 +65,6 @@ private:
     QColor m_borderColor;
     qreal m_borderWidth;
 
-    QQuickShapePath *m_shapePath;
     QQuickText *m_labelItem = nullptr;
     QQuickShape *m_labelShape = nullptr;
     QQuickShapePath *m_labelPath = nullptr;
@@ -117,7 +117,7 @@ void QGraphsView::insertSeries(qsizetype index, QObject *object)
             m_seriesList.insert(index, series);
 
             QObject::connect(series, &QAbstractSeries::update,
-                             this, &QGraphsView::polishAndUpdate);
+                             this, &QGraphsView::handleSeriesUpdate);
             QObject::connect(series, &QAbstractSeries::hoverEnter,
                              this, &QGraphsView::handleHoverEnter);
             QObject::connect(series, &QAbstractSeries::hoverExit,
@@ -146,6 +146,9 @@ void QGraphsView::removeSeries(QObject *object)
     if (auto series = reinterpret_cast<QAbstractSeries *>(object)) {
         series->setGraph(nullptr);
         m_seriesList.removeAll(series);
+        m_dirtySeries.remove(series);
+        QObject::disconnect(series, &QAbstractSeries::update,
+                            this, &QGraphsView::handleSeriesUpdate);
         auto &cleanupSeriesList = m_cleanupSeriesList[getSeriesRendererIndex(series)];
 
 #ifdef USE_PIEGRAPH
@@ -497,6 +500,51 @@ void QGraphsView::handleHover(const QString &seriesName, QPointF position, QPoin
     emit hover(seriesName, position, value);
 }
 
+void QGraphsView::handleSeriesUpdate()
+{
+    polishSeries(qobject_cast<QAbstractSeries *>(sender()));
+}
+
+// Schedules a polish pass for series, or for all series when it is null. Changes are
+// coalesced until the pass, which is delayed according to maxUpdateRate.
+void QGraphsView::polishSeries(QAbstractSeries *series)
+{
+    // Data, style and visibility changes of a series only need that series
+    // to be polished again.
+    if (series)
+        m_dirtySeries.insert(series);
+    else
+        m_allSeriesDirty = true;
+
+    // A polish pass is already scheduled, it will pick up this change too.
+    if (m_seriesPolishPending) {
+        m_coalescedUpdateCount++;
+        return;
+    }
+    m_seriesPolishPending = true;
+
+    if (m_maxUpdateRate > 0 && m_lastPolishTimer.isValid()) {
+        const qint64 interval = qint64(1000.0 / m_maxUpdateRate);
+        const qint64 elapsed = m_lastPolishTimer.elapsed();
+        if (elapsed < interval) {
+            if (!m_updateRateTimer) {
+                m_updateRateTimer = new QTimer(this);
+                m_updateRateTimer->setSingleShot(true);
+                m_updateRateTimer->setTimerType(Qt::PreciseTimer);
+                QObject::connect(m_updateRateTimer, &QTimer::timeout, this, [this]() {
+                    polish();
+                    update();
+                });
+            }
+            m_updateRateTimer->start(int(interval - elapsed));
+            return;
+        }
+    }
+
+    polish();
+    update();
+}
+
 void QGraphsView::updateComponentSizes()
 {
     updateAxisAreas();
@@ -539,7 +587,7 @@ void QGraphsView::componentComplete()
 {
     if (!m_theme) {
         m_theme = m_defaultTheme;
-        QObject::connect(m_theme, &QGraphsTheme::update, this, &QQuickItem::update);
+        QObject::connect(m_theme, &QGraphsTheme::update, this, &QGraphsView::polishAndUpdate);
         m_theme->resetColorTheme();
     }
     QQuickItem::componentComplete();
@@ -553,6 +601,7 @@ void QGraphsView::geometryChange(const QRectF &newGeometry, const QRectF &oldGeo
 
     updateComponentSizes();
 
+    m_allSeriesDirty = true;
     ensurePolished();
 }
 
@@ -572,10 +621,11 @@ void QGraphsView::mouseMoveEvent(QMouseEvent *event)
         handled |= m_pointRenderer->handleMouseMove(&mappedEvent);
 #endif
 
+    // Handled events change the series, which polishes only them again
     if (!handled)
         event->ignore();
     else
-        polishAndUpdate();
+        update();
 }
 
 void QGraphsView::mousePressEvent(QMouseEvent *event)
@@ -607,7 +657,7 @@ void QGraphsView::mousePressEvent(QMouseEvent *event)
     if (!handled)
         event->ignore();
     else
-        polishAndUpdate();
+        update();
 }
 
 void QGraphsView::mouseReleaseEvent(QMouseEvent *event)
@@ -629,7 +679,7 @@ void QGraphsView::mouseReleaseEvent(QMouseEvent *event)
     if (!handled)
         event->ignore();
     else
-        polishAndUpdate();
+        update();
 }
 
 void QGraphsView::hoverMoveEvent(QHoverEvent *event)
@@ -744,6 +794,11 @@ QSGNode *QGraphsView::updatePaintNode(QSGNode *oldNode, QQuickItem::UpdatePaintN
 
 void QGraphsView::updatePolish()
 {
+    m_seriesPolishPending = false;
+    if (m_updateRateTimer)
+        m_updateRateTimer->stop();
+    m_lastPolishTimer.start();
+
     if (m_axisRenderer) {
         m_axisRenderer->handlePolish();
         // Initialize shaders after system's event queue
@@ -766,8 +821,14 @@ void QGraphsView::updatePolish()
         m_backgroundRectangle = nullptr;
     }
 
-    // Polish for all series
+    // Polish only the series which have changed since the last polish,
+    // or all of them when the axes, size or theme have changed.
+    const bool polishAll = std::exchange(m_allSeriesDirty, false);
+    const auto dirtySeries = std::exchange(m_dirtySeries, {});
     for (auto series : std::as_const(m_seriesList)) {
+        if (!polishAll && !dirtySeries.contains(series))
+            continue;
+
 #ifdef USE_BARGRAPH
         if (m_barsRenderer) {
             if (auto barSeries = qobject_cast<QBarSeries*>(series))
@@ -833,10 +894,16 @@ void QGraphsView::updatePolish()
         m_pieRenderer->afterPolish(cleanupSeriesList);
     }
 #endif
+
+    if (m_reportedCoalescedUpdateCount != m_coalescedUpdateCount) {
+        m_reportedCoalescedUpdateCount = m_coalescedUpdateCount;
+        emit coalescedUpdateCountChanged();
+    }
 }
 
 void QGraphsView::polishAndUpdate()
 {
+    m_allSeriesDirty = true;
     polish();
     update();
 }
@@ -1125,7 +1192,7 @@ void QGraphsView::setAxisX(QAbstractAxis *axis)
             axis->setAlignment(Qt::AlignBottom);
         addAxis(axis);
     }
-    emit update();
+    polishAndUpdate();
 }
 
 /*!
@@ -1156,7 +1223,7 @@ void QGraphsView::setAxisY(QAbstractAxis *axis)
             axis->setAlignment(Qt::AlignLeft);
         addAxis(axis);
     }
-    emit update();
+    polishAndUpdate();
 }
 
 /*!
@@ -1188,7 +1255,95 @@ void QGraphsView::setOrientation(Qt::Orientation newOrientation)
         return;
     m_orientation = newOrientation;
     emit orientationChanged();
-    emit update();
+    polishAndUpdate();
+}
+
+/*!
+    \property QGraphsView::maxUpdateRate
+    \since 6.9
+    \brief The maximum number of times per second the series are updated.
+
+    Changes to the series data are accumulated and applied in a single pass
+    at most once per frame. When this property is set, the passes are further
+    limited to this many passes per second, which is useful when the data
+    changes much more often than it needs to be shown. Changes to the axes,
+    theme or size of the graph are always applied on the next frame.
+    The default value is \c 0, which updates on every frame.
+    \sa coalescedUpdateCount
+*/
+/*!
+    \qmlproperty real GraphsView::maxUpdateRate
+    \since 6.9
+    The maximum number of times per second the series are updated.
+
+    Changes to the series data are accumulated and applied in a single pass
+    at most once per frame. When this property is set, the passes are further
+    limited to this many passes per second, which is useful when the data
+    changes much more often than it needs to be shown. Changes to the axes,
+    theme or size of the graph are always applied on the next frame.
+    The default value is \c 0, which updates on every frame.
+    \sa coalescedUpdateCount
+*/
+qreal QGraphsView::maxUpdateRate() const
+{
+    return m_maxUpdateRate;
+}
+
+void QGraphsView::setMaxUpdateRate(qreal rate)
+{
+    rate = qMax(rate, 0.0);
+    if (qFuzzyCompare(m_maxUpdateRate, rate))
+        return;
+    m_maxUpdateRate = rate;
+    // Apply a delayed update now, the next one is limited by the new rate
+    if (m_updateRateTimer && m_updateRateTimer->isActive()) {
+        m_updateRateTimer->stop();
+        polish();
+        update();
+    }
+    emit maxUpdateRateChanged();
+}
+
+/*!
+    \property QGraphsView::coalescedUpdateCount
+    \since 6.9
+    \brief The number of series updates merged into an already scheduled update.
+
+    Every series change which did not need an update pass of its own is
+    counted. The count can be reset with resetCoalescedUpdateCount().
+    \sa maxUpdateRate
+*/
+/*!
+    \qmlproperty int GraphsView::coalescedUpdateCount
+    \since 6.9
+    \readonly
+    The number of series updates merged into an already scheduled update.
+
+    Every series change which did not need an update pass of its own is
+    counted. The count can be reset with resetCoalescedUpdateCount().
+    \sa maxUpdateRate
+*/
+int QGraphsView::coalescedUpdateCount() const
+{
+    return m_coalescedUpdateCount;
+}
+
+/*!
+    \qmlmethod GraphsView::resetCoalescedUpdateCount()
+    \since 6.9
+    Resets \l coalescedUpdateCount to \c 0.
+*/
+/*!
+    \since 6.9
+    Resets \l coalescedUpdateCount to \c 0.
+*/
+void QGraphsView::resetCoalescedUpdateCount()
+{
+    if (m_coalescedUpdateCount == 0)
+        return;
+    m_coalescedUpdateCount = 0;
+    m_reportedCoalescedUpdateCount = 0;
+    emit coalescedUpdateCountChanged();
 }
 
 int QGraphsView::getSeriesRendererIndex(QAbstractSeries *series)
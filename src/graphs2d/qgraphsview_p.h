@@ -15,13 +15,16 @@
 // We mean it.
 
 #include <QtQuick/QQuickItem>
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QList>
+#include <QtCore/QSet>
 #include <QtQml/QQmlListProperty>
 #include <QtGraphs/qabstractseries.h>
 #include <QtGraphs/qgraphstheme.h>
 
 QT_BEGIN_NAMESPACE
 
+class QTimer;
 class QQuickRectangle;
 class QAbstractAxis;
 class AxisRenderer;
@@ -57,6 +60,10 @@ class Q_GRAPHS_EXPORT QGraphsView : public QQuickItem
     Q_PROPERTY(QAbstractAxis *axisY READ axisY WRITE setAxisY NOTIFY axisYChanged FINAL)
     Q_PROPERTY(
         Qt::Orientation orientation READ orientation WRITE setOrientation NOTIFY orientationChanged FINAL)
+    Q_PROPERTY(qreal maxUpdateRate READ maxUpdateRate WRITE setMaxUpdateRate NOTIFY
+                   maxUpdateRateChanged REVISION(6, 9))
+    Q_PROPERTY(int coalescedUpdateCount READ coalescedUpdateCount NOTIFY
+                   coalescedUpdateCountChanged REVISION(6, 9))
 
     Q_CLASSINFO("DefaultProperty", "seriesList")
     QML_NAMED_ELEMENT(GraphsView)
@@ -149,10 +156,17 @@ public:
     Qt::Orientation orientation() const;
     void setOrientation(Qt::Orientation newOrientation);
 
+    qreal maxUpdateRate() const;
+    void setMaxUpdateRate(qreal rate);
+
+    int coalescedUpdateCount() const;
+    Q_REVISION(6, 9) Q_INVOKABLE void resetCoalescedUpdateCount();
+
 protected:
     void handleHoverEnter(const QString &seriesName, QPointF position, QPointF value);
     void handleHoverExit(const QString &seriesName, QPointF position);
     void handleHover(const QString &seriesName, QPointF position, QPointF value);
+    void handleSeriesUpdate();
     void updateComponentSizes();
     void componentComplete() override;
     void geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry) override;
@@ -189,6 +203,8 @@ Q_SIGNALS:
     void axisYChanged();
 
     void orientationChanged();
+    Q_REVISION(6, 9) void maxUpdateRateChanged();
+    Q_REVISION(6, 9) void coalescedUpdateCountChanged();
 
 private:
     friend class AxisRenderer;
@@ -196,8 +212,13 @@ private:
     friend class PointRenderer;
     friend class AreaRenderer;
     friend class QAbstractAxis;
+    friend class tst_qgpieseries;
+    friend class tst_datetimeaxis;
+    friend class tst_scatter;
+    friend class tst_bench_xyseries2d;
 
     void polishAndUpdate();
+    void polishSeries(QAbstractSeries *series);
     int getSeriesRendererIndex(QAbstractSeries *series);
 
     AxisRenderer *m_axisRenderer = nullptr;
@@ -207,6 +228,18 @@ private:
     AreaRenderer *m_areaRenderer = nullptr;
     QList<QObject *> m_seriesList;
     QHash<int, QList<QAbstractSeries *>> m_cleanupSeriesList;
+    // Series which need to be polished on the next updatePolish(). When
+    // m_allSeriesDirty is set, every series is polished.
+    QSet<QObject *> m_dirtySeries;
+    bool m_allSeriesDirty = true;
+    // Series updates are coalesced until the next polish pass, which is
+    // delayed by m_updateRateTimer when maxUpdateRate is set.
+    bool m_seriesPolishPending = false;
+    qreal m_maxUpdateRate = 0;
+    int m_coalescedUpdateCount = 0;
+    int m_reportedCoalescedUpdateCount = 0;
+    QElapsedTimer m_lastPolishTimer;
+    QTimer *m_updateRateTimer = nullptr;
     QQuickRectangle *m_backgroundRectangle = nullptr;
 
     QAbstractAxis *m_axisX = nullptr;
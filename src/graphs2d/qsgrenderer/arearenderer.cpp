@@ -6,10 +6,16 @@
 #include <private/arearenderer_p.h>
 #include <private/pointrenderer_p.h>
 #include <private/axisrenderer_p.h>
+#include <private/charthelpers_p.h>
+#include <private/coloredgeometry_p.h>
 #include <private/qabstractseries_p.h>
 #include <private/qareaseries_p.h>
 #include <private/qgraphsview_p.h>
 #include <private/qxyseries_p.h>
+#include <QtGui/qrgb.h>
+#include <QtQuick/QQuickWindow>
+#include <QtQuick/QSGGeometryNode>
+#include <algorithm>
 
 QT_BEGIN_NAMESPACE
 
@@ -49,6 +55,23 @@ void AreaRenderer::calculateAxisCoordinates(qreal origX,
              - origY / m_areaHeight / m_maxVertical;
 }
 
+QList<QPointF> AreaRenderer::decimatedPoints(QXYSeries *series)
+{
+    // Same device pixel column mapping as PointRenderer uses for the decimation of lines
+    const qreal dpr = window() ? window()->effectiveDevicePixelRatio() : 1.0;
+    const auto &indexes = series->d_func()->decimatedIndexes(m_areaWidth * m_maxHorizontal * dpr,
+                                                             m_horizontalOffset * dpr);
+    auto &&points = series->points();
+    if (indexes.isEmpty())
+        return points;
+
+    QList<QPointF> result;
+    result.reserve(indexes.size());
+    for (qsizetype index : indexes)
+        result.append(points.at(index));
+    return result;
+}
+
 void AreaRenderer::handlePolish(QAreaSeries *series)
 {
     auto theme = m_graph->theme();
@@ -80,6 +103,10 @@ void AreaRenderer::handlePolish(QAreaSeries *series)
         auto painterPath = group->painterPath;
         painterPath.clear();
         group->shapePath->setPath(painterPath);
+        group->columns.clear();
+        group->vertices.clear();
+        group->nodeDirty = true;
+        update();
         return;
     }
 
@@ -133,7 +160,31 @@ void AreaRenderer::handlePolish(QAreaSeries *series)
     group->shapePath->setFillColor(color);
     group->shapePath->setCapStyle(QQuickShapePath::CapStyle::SquareCap);
 
-    auto &&upperPoints = upper->points();
+    const QList<QPointF> upperPoints = decimatedPoints(upper);
+    const QList<QPointF> lowerPoints = lower ? decimatedPoints(lower) : QList<QPointF>();
+
+    // Without splines the outline has no curves, so an area which can be split into columns
+    // is drawn from a geometry node and does not need to be triangulated by the shape
+    const bool splines = upper->type() == QAbstractSeries::SeriesType::Spline
+                         || (lower && lower->type() == QAbstractSeries::SeriesType::Spline);
+    group->columns.clear();
+    group->vertices.clear();
+    group->drawGeometry = false;
+    group->nodeDirty = true;
+    update();
+    if (series->isVisible() && updateAreaColumns(group, upperPoints, lowerPoints) && !splines) {
+        group->drawGeometry = true;
+        updateAreaVertices(group, color, borderColor, borderWidth);
+    }
+
+    if (group->drawGeometry) {
+        group->shapePath->setPath(painterPath);
+
+        QList<QLegendData> legendDataList = {{color, borderColor, series->name()}};
+        series->d_func()->setLegendData(legendDataList);
+        return;
+    }
+
     QList<QPointF> fittedPoints;
 #ifdef USE_SPLINEGRAPH
     if (upper->type() == QAbstractSeries::SeriesType::Spline)
@@ -157,7 +208,7 @@ void AreaRenderer::handlePolish(QAreaSeries *series)
             if (i == 0) {
                 painterPath.moveTo(x, y);
             } else {
-                if (i < upper->points().size()
+                if (i < upperPoints.size()
                     && upper->type() == QAbstractSeries::SeriesType::Spline) {
                     qreal x1, y1, x2, y2;
                     calculateRenderCoordinates(fittedPoints[j - 1].x(),
@@ -176,7 +227,6 @@ void AreaRenderer::handlePolish(QAreaSeries *series)
     }
 
     if (lower && series->isVisible()) {
-        auto &&lowerPoints = lower->points();
         QList<QPointF> fittedPoints;
 #ifdef USE_SPLINEGRAPH
         if (lower->type() == QAbstractSeries::SeriesType::Spline)
@@ -219,6 +269,105 @@ void AreaRenderer::handlePolish(QAreaSeries *series)
     series->d_func()->setLegendData(legendDataList);
 }
 
+bool AreaRenderer::updateAreaColumns(PointGroup *group,
+                                     const QList<QPointF> &upperPoints,
+                                     const QList<QPointF> &lowerPoints)
+{
+    // The columns are used for hit testing also when the area is drawn by the shape.
+    // Without a lower series the area reaches down to zero.
+    const QTransform transform(m_areaWidth * m_maxHorizontal,
+                               0,
+                               0,
+                               -m_areaHeight * m_maxVertical,
+                               -m_horizontalOffset,
+                               m_areaHeight + m_verticalOffset);
+    QList<QPointF> upper;
+    QList<QPointF> lower;
+    mapPoints(upperPoints, transform, upper);
+    if (lowerPoints.isEmpty()) {
+        const QPointF zeroLine[] = { QPointF(upperPoints.first().x(), 0),
+                                     QPointF(upperPoints.last().x(), 0) };
+        mapPoints(zeroLine, transform, lower);
+    } else {
+        mapPoints(lowerPoints, transform, lower);
+    }
+    return areaColumns(upper, lower, group->columns);
+}
+
+void AreaRenderer::updateAreaVertices(PointGroup *group,
+                                      QColor color,
+                                      QColor borderColor,
+                                      qreal borderWidth)
+{
+    // The outline runs along the upper points and back along the lower ones
+    const auto &columns = group->columns;
+    const qsizetype count = columns.size() / 2;
+    QList<QPointF> outline(columns.size());
+    for (qsizetype i = 0; i < count; ++i) {
+        outline[i] = columns[2 * i];
+        outline[outline.size() - 1 - i] = columns[2 * i + 1];
+    }
+    QList<QPointF> miters;
+    polygonMiters(outline, miters);
+
+    const qreal feather = featherWidth(this);
+    auto &vertices = group->vertices;
+    vertices.reserve(6 * (count - 1) + 6 * outline.size()
+                     + (borderWidth > 0 ? 27 * outline.size() : 0));
+
+    // The fill reaches up to the inner edge of its antialiasing ring
+    const QRgb fillColor = qPremultiply(color.rgba());
+    auto inner = [&](qsizetype index) { return outline[index] - miters[index] * (feather * 0.5); };
+    for (qsizetype i = 0; i < count - 1; ++i) {
+        const qsizetype lower = outline.size() - 1 - i;
+        appendColoredVertex(vertices, inner(i), fillColor);
+        appendColoredVertex(vertices, inner(lower), fillColor);
+        appendColoredVertex(vertices, inner(i + 1), fillColor);
+        appendColoredVertex(vertices, inner(i + 1), fillColor);
+        appendColoredVertex(vertices, inner(lower), fillColor);
+        appendColoredVertex(vertices, inner(lower - 1), fillColor);
+    }
+    featherPolygon(outline, miters, feather, fillColor, vertices);
+
+    if (borderWidth > 0)
+        strokePolygon(outline, borderWidth, feather, qPremultiply(borderColor.rgba()), vertices);
+}
+
+void AreaRenderer::updateAreaNode(QSGNode *root, QAreaSeries *series, PointGroup *group)
+{
+    if (!group->drawGeometry || group->vertices.isEmpty()) {
+        m_nodes.deleteNode(series);
+        return;
+    }
+
+    auto node = m_nodes.node(root, series);
+    auto geometry = node->geometry();
+    geometry->allocate(group->vertices.size());
+    std::copy(group->vertices.cbegin(),
+              group->vertices.cend(),
+              geometry->vertexDataAsColoredPoint2D());
+    node->markDirty(QSGNode::DirtyGeometry);
+}
+
+QSGNode *AreaRenderer::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *updatePaintNodeData)
+{
+    Q_UNUSED(updatePaintNodeData);
+
+    const bool recreated = !oldNode;
+    QSGNode *root = recreated ? new QSGNode() : oldNode;
+    m_nodes.sync(recreated);
+
+    for (auto it = m_groups.cbegin(); it != m_groups.cend(); ++it) {
+        auto group = it.value();
+        if (!group->nodeDirty && !recreated)
+            continue;
+        group->nodeDirty = false;
+        updateAreaNode(root, it.key(), group);
+    }
+
+    return root;
+}
+
 void AreaRenderer::afterPolish(QList<QAbstractSeries *> &cleanupSeries)
 {
     for (auto series : cleanupSeries) {
@@ -230,6 +379,9 @@ void AreaRenderer::afterPolish(QList<QAbstractSeries *> &cleanupSeries)
             painterPath.clear();
             group->shapePath->setPath(painterPath);
 
+            if (m_nodes.release(areaSeries))
+                update();
+
             delete group;
             m_groups.remove(areaSeries);
         }
@@ -248,14 +400,14 @@ void AreaRenderer::updateSeries(QAreaSeries *series)
 
 // Point inside triangle code from
 // https://stackoverflow.com/questions/2049582/how-to-determine-if-a-point-is-in-a-2d-triangle
-float sign(QPoint p1, QPoint p2, QPoint p3)
+static qreal sign(QPointF p1, QPointF p2, QPointF p3)
 {
     return (p1.x() - p3.x()) * (p2.y() - p3.y()) - (p2.x() - p3.x()) * (p1.y() - p3.y());
 }
 
-bool pointInTriangle(QPoint pt, QPoint v1, QPoint v2, QPoint v3)
+static bool pointInTriangle(QPointF pt, QPointF v1, QPointF v2, QPointF v3)
 {
-    float d1, d2, d3;
+    qreal d1, d2, d3;
     bool hasNeg, hasPos;
 
     d1 = sign(pt, v1, v2);
@@ -268,68 +420,39 @@ bool pointInTriangle(QPoint pt, QPoint v1, QPoint v2, QPoint v3)
     return !(hasNeg && hasPos);
 }
 
-bool AreaRenderer::pointInArea(QPoint pt, QAreaSeries *series) const
+bool AreaRenderer::pointInArea(QPointF pt, const PointGroup *group) const
 {
-    QList<QPointF> upperPoints = series->upperSeries()->points();
-    QList<QPointF> lowerPoints;
-
-    if (series->lowerSeries())
-        lowerPoints = series->lowerSeries()->points();
-
-    QList<QPointF> *firstPoints = &upperPoints;
-    if (lowerPoints.size() > upperPoints.size())
-        firstPoints = &lowerPoints;
-
-    for (int i = 0; i < firstPoints->size() - 1; ++i) {
-        qreal x1, y1, x2, y2, x3, y3, x4, y4;
-        calculateRenderCoordinates((*firstPoints)[i].x(), (*firstPoints)[i].y(), &x1, &y1);
-        calculateRenderCoordinates((*firstPoints)[i + 1].x(), (*firstPoints)[i + 1].y(), &x2, &y2);
-
-        bool needSecondTriangleTest = true;
-        if (series->lowerSeries()) {
-            QList<QPointF> *secondPoints = &lowerPoints;
-            if (lowerPoints.size() > upperPoints.size())
-                secondPoints = &upperPoints;
-
-            qsizetype firstIndex = i;
-            qsizetype secondIndex = i + 1;
-
-            if (firstIndex >= secondPoints->size())
-                firstIndex = secondPoints->size() - 1;
-            if (secondIndex >= secondPoints->size())
-                needSecondTriangleTest = false;
-
-            calculateRenderCoordinates((*secondPoints)[firstIndex].x(),
-                                       (*secondPoints)[firstIndex].y(),
-                                       &x3,
-                                       &y3);
-
-            if (needSecondTriangleTest) {
-                calculateRenderCoordinates((*secondPoints)[secondIndex].x(),
-                                           (*secondPoints)[secondIndex].y(),
-                                           &x4,
-                                           &y4);
-            } else {
-                x4 = 0.0;
-                y4 = 0.0;
-            }
-        } else {
-            calculateRenderCoordinates(upperPoints[i].x(), 0, &x3, &y3);
-            calculateRenderCoordinates(upperPoints[i + 1].x(), 0, &x4, &y4);
-        }
-
-        QPoint point1(x1, y1);
-        QPoint point2(x2, y2);
-        QPoint point3(x3, y3);
-        QPoint point4(x4, y4);
-
-        if (pointInTriangle(pt, point1, point2, point3)
-            || (needSecondTriangleTest && pointInTriangle(pt, point2, point3, point4))) {
-            return true;
-        }
+    // Areas which can't be split into columns are tested against their shape path
+    const auto &columns = group->columns;
+    const qsizetype count = columns.size() / 2;
+    if (count < 2)
+        return group->painterPath.contains(pt);
+
+    // Each column between two upper and lower point pairs is tested as two triangles
+    auto pointInColumn = [&](qsizetype column) {
+        if (column < 0 || column >= count - 1)
+            return false;
+        const QPointF &upper1 = columns[2 * column];
+        const QPointF &lower1 = columns[2 * column + 1];
+        const QPointF &upper2 = columns[2 * column + 2];
+        const QPointF &lower2 = columns[2 * column + 3];
+        return pointInTriangle(pt, upper1, upper2, lower1)
+               || pointInTriangle(pt, upper2, lower1, lower2);
+    };
+
+    // Finds the last column starting at or before pt. Columns are sorted by x, and the upper
+    // and lower point of a column have the same x.
+    qsizetype first = 0;
+    qsizetype end = count;
+    while (first < end) {
+        const qsizetype middle = first + (end - first) / 2;
+        if (columns[2 * middle].x() <= pt.x())
+            first = middle + 1;
+        else
+            end = middle;
     }
-
-    return false;
+    // A point on the boundary of two columns is at the end of the previous one
+    return pointInColumn(first - 1) || pointInColumn(first - 2);
 }
 
 bool AreaRenderer::handleMousePress(QMouseEvent *event)
@@ -345,7 +468,7 @@ bool AreaRenderer::handleMousePress(QMouseEvent *event)
         if (group->series->lowerSeries() && group->series->lowerSeries()->count() < 2)
             continue;
 
-        if (pointInArea(event->pos(), group->series)) {
+        if (pointInArea(event->position(), group)) {
             group->series->setSelected(!group->series->isSelected());
             handled = true;
         }
@@ -371,7 +494,7 @@ bool AreaRenderer::handleHoverMove(QHoverEvent *event)
         const QString &name = group->series->name();
 
         bool hovering = false;
-        if (pointInArea(position.toPoint(), group->series)) {
+        if (pointInArea(position, group)) {
             qreal x, y;
             calculateAxisCoordinates(position.x(), position.y(), &x, &y);
 
@@ -17,11 +17,14 @@
 #include <QPainterPath>
 #include <QQuickItem>
 #include <QtQuickShapes/private/qquickshape_p.h>
+#include <QtQuick/QSGGeometry>
+#include <private/coloredgeometry_p.h>
 
 QT_BEGIN_NAMESPACE
 
 class QGraphsView;
 class QAreaSeries;
+class QXYSeries;
 class AxisRenderer;
 class QAbstractSeries;
 
@@ -39,6 +42,9 @@ public:
     bool handleMousePress(QMouseEvent *event);
     bool handleHoverMove(QHoverEvent *event);
 
+protected:
+    QSGNode *updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *updatePaintNodeData) override;
+
 Q_SIGNALS:
 
 private:
@@ -50,11 +56,21 @@ private:
         qsizetype colorIndex = -1;
         qsizetype borderColorIndex = -1;
         bool hover = false;
+        // Upper and lower points in render coordinates, interleaved in columns of the same x.
+        // Used for hit testing, and for areas without splines as the columns of the fill.
+        // Those areas are drawn from a geometry node instead of the shape path, with their
+        // antialiased fill and border in the same vertex data. Areas which can't be split
+        // into columns are drawn and hit tested with the shape path.
+        QList<QPointF> columns;
+        bool drawGeometry = false;
+        ColoredVertices vertices;
+        bool nodeDirty = true;
     };
 
     QGraphsView *m_graph = nullptr;
     QQuickShape m_shape;
     QMap<QAreaSeries *, PointGroup *> m_groups;
+    ColoredGeometryNodes m_nodes;
 
     // Render area variables
     qreal m_maxVertical = 0;
@@ -66,7 +82,16 @@ private:
 
     void calculateRenderCoordinates(qreal origX, qreal origY, qreal *renderX, qreal *renderY) const;
     void calculateAxisCoordinates(qreal origX, qreal origY, qreal *axisX, qreal *axisY) const;
-    bool pointInArea(QPoint pt, QAreaSeries *series) const;
+    bool pointInArea(QPointF pt, const PointGroup *group) const;
+    QList<QPointF> decimatedPoints(QXYSeries *series);
+    bool updateAreaColumns(PointGroup *group,
+                           const QList<QPointF> &upperPoints,
+                           const QList<QPointF> &lowerPoints);
+    void updateAreaVertices(PointGroup *group,
+                            QColor color,
+                            QColor borderColor,
+                            qreal borderWidth);
+    void updateAreaNode(QSGNode *root, QAreaSeries *series, PointGroup *group);
 };
 
 QT_END_NAMESPACE
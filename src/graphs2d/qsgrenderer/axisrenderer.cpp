@@ -11,6 +11,8 @@
 #include <private/qdatetimeaxis_p.h>
 #include <private/qgraphsview_p.h>
 #include <private/qvalueaxis_p.h>
+#include <QtCore/qmath.h>
+#include <QtQuick/QSGGeometryNode>
 
 QT_BEGIN_NAMESPACE
 
@@ -152,13 +154,8 @@ void AxisRenderer::updateAxis()
 
     if (vertical != m_wasVertical) {
         // Orientation has changed, so clear possible custom elements
-        for (auto &item : m_xAxisTextItems)
-            item->deleteLater();
-        m_xAxisTextItems.clear();
-
-        for (auto &item : m_yAxisTextItems)
-            item->deleteLater();
-        m_yAxisTextItems.clear();
+        removeAxisLabelItems(m_xAxisTextItems);
+        removeAxisLabelItems(m_yAxisTextItems);
 
         m_wasVertical = vertical;
     }
@@ -261,27 +258,29 @@ void AxisRenderer::updateAxis()
         m_axisVerticalMinValue = vaxis->min().toMSecsSinceEpoch();
         m_axisVerticalValueRange = std::abs(m_axisVerticalMaxValue - m_axisVerticalMinValue);
 
-        // in ms
-        double segment;
+        // Without an interval, ticks are placed on calendar aligned steps
         if (interval <= 0) {
-            segment = getValueStepsFromRange(m_axisVerticalValueRange);
-            interval = m_axisVerticalValueRange / segment;
+            m_axisVerticalDateTimeTicks = DateTimeTicks::calendarTicks(vaxis->min(),
+                                                                       vaxis->max());
         } else {
-            segment = m_axisVerticalValueRange / interval;
+            m_axisVerticalDateTimeTicks = DateTimeTicks::intervalTicks(
+                vaxis->min(), vaxis->max(), std::clamp(interval, 1.0, MAX_DIVS));
         }
 
-        m_axisVerticalMinLabel = std::clamp(interval, 1.0, MAX_DIVS);
-
-        m_axisVerticalValueStep = segment;
+        m_axisVerticalValueStep = m_axisVerticalDateTimeTicks.stepMSecs;
         int axisVerticalSubTickCount = vaxis->subTickCount();
         m_axisVerticalSubGridScale = axisVerticalSubTickCount > 0
                                            ? 1.0 / (axisVerticalSubTickCount + 1)
                                            : 1.0;
         m_axisVerticalStepPx = (height() - m_graph->m_marginTop - m_graph->m_marginBottom
                                 - axisHeight)
-                               / (qFuzzyCompare(segment, 0)
-                                      ? interval
+                               / (qFuzzyIsNull(m_axisVerticalValueRange)
+                                      ? 1.0
                                       : (m_axisVerticalValueRange / m_axisVerticalValueStep));
+        double axisVerticalValueDiff = m_axisVerticalDateTimeTicks.firstMSecs
+                                       - m_axisVerticalMinValue;
+        m_axisYDisplacement = -(axisVerticalValueDiff / m_axisVerticalValueStep)
+                              * m_axisVerticalStepPx;
 
         updateDateTimeYAxisLabels(vaxis, m_graph->m_yAxisLabelsArea);
     }
@@ -294,27 +293,30 @@ void AxisRenderer::updateAxis()
         m_axisHorizontalMinValue = haxis->min().toMSecsSinceEpoch();
         m_axisHorizontalValueRange = std::abs(m_axisHorizontalMaxValue - m_axisHorizontalMinValue);
 
-        // in ms
-        double segment;
+        // Without an interval, ticks are placed on calendar aligned steps
         if (interval <= 0) {
-            segment = getValueStepsFromRange(m_axisHorizontalValueRange);
-            interval = m_axisHorizontalValueRange / segment;
+            m_axisHorizontalDateTimeTicks = DateTimeTicks::calendarTicks(haxis->min(),
+                                                                         haxis->max());
         } else {
-            segment = m_axisHorizontalValueRange / interval;
+            m_axisHorizontalDateTimeTicks = DateTimeTicks::intervalTicks(
+                haxis->min(), haxis->max(), std::clamp(interval, 1.0, MAX_DIVS));
         }
 
-        m_axisHorizontalMinLabel = std::clamp(interval, 1.0, MAX_DIVS);
-
-        m_axisHorizontalValueStep = segment;
+        m_axisHorizontalValueStep = m_axisHorizontalDateTimeTicks.stepMSecs;
         int axisHorizontalSubTickCount = haxis->subTickCount();
         m_axisHorizontalSubGridScale = axisHorizontalSubTickCount > 0
                                              ? 1.0 / (axisHorizontalSubTickCount + 1)
                                              : 1.0;
         m_axisHorizontalStepPx = (width() - m_graph->m_marginLeft - m_graph->m_marginRight
                                   - axisWidth)
-                                 / (qFuzzyCompare(segment, 0)
-                                        ? interval
+                                 / (qFuzzyIsNull(m_axisHorizontalValueRange)
+                                        ? 1.0
                                         : (m_axisHorizontalValueRange / m_axisHorizontalValueStep));
+        double axisHorizontalValueDiff = m_axisHorizontalDateTimeTicks.firstMSecs
+                                         - m_axisHorizontalMinValue;
+        m_axisXDisplacement = -(axisHorizontalValueDiff / m_axisHorizontalValueStep)
+                              * m_axisHorizontalStepPx;
+
         updateDateTimeXAxisLabels(haxis, m_graph->m_xAxisLabelsArea);
     }
 
@@ -322,6 +324,7 @@ void AxisRenderer::updateAxis()
     updateAxisTickersShadow();
     updateAxisGrid();
     updateAxisGridShadow();
+    updateDateTimeLines();
     updateAxisTitles(m_graph->m_xAxisLabelsArea, m_graph->m_yAxisLabelsArea);
 }
 
@@ -351,7 +354,8 @@ void AxisRenderer::updateAxisTickers()
                                          / (m_axisVerticalValueRange / m_axisVerticalValueStep));
         m_axisTickerVertical->setSubTicksVisible(!qFuzzyCompare(m_axisVerticalSubGridScale, 1.0));
         m_axisTickerVertical->setSubTickScale(m_axisVerticalSubGridScale);
-        m_axisTickerVertical->setVisible(m_axisVertical->isVisible());
+        m_axisTickerVertical->setVisible(m_axisVertical->isVisible()
+                                         && !hasCalendarDateTimeTicks(false));
         // Axis line
         m_axisLineVertical->setColor(theme()->axisY().mainColor());
         m_axisLineVertical->setLineWidth(theme()->axisY().mainWidth());
@@ -372,6 +376,9 @@ void AxisRenderer::updateAxisTickers()
         m_axisLineVertical->setVisible(false);
         for (auto &textItem : m_yAxisTextItems)
             textItem->setVisible(false);
+        m_yLabelBatch.clear();
+        if (m_yLabelBatch.isDirty())
+            update();
     }
 
     if (m_axisHorizontal) {
@@ -397,7 +404,8 @@ void AxisRenderer::updateAxisTickers()
                                          / (m_axisHorizontalValueRange / m_axisHorizontalValueStep));
         m_axisTickerHorizontal->setSubTicksVisible(!qFuzzyCompare(m_axisHorizontalSubGridScale, 1.0));
         m_axisTickerHorizontal->setSubTickScale(m_axisHorizontalSubGridScale);
-        m_axisTickerHorizontal->setVisible(m_axisHorizontal->isVisible());
+        m_axisTickerHorizontal->setVisible(m_axisHorizontal->isVisible()
+                                           && !hasCalendarDateTimeTicks(true));
         // Axis line
         m_axisLineHorizontal->setColor(theme()->axisX().mainColor());
         m_axisLineHorizontal->setLineWidth(theme()->axisX().mainWidth());
@@ -417,6 +425,9 @@ void AxisRenderer::updateAxisTickers()
         m_axisLineHorizontal->setVisible(false);
         for (auto &textItem : m_xAxisTextItems)
             textItem->setVisible(false);
+        m_xLabelBatch.clear();
+        if (m_xLabelBatch.isDirty())
+            update();
     }
 }
 
@@ -516,10 +527,12 @@ void AxisRenderer::updateAxisGrid()
                              / (m_axisHorizontalValueRange / m_axisHorizontalValueStep));
     m_axisGrid->setGridHeight((m_axisGrid->height() - topPadding - bottomPadding)
                               / (m_axisVerticalValueRange / m_axisVerticalValueStep));
-    m_axisGrid->setGridVisibility(QVector4D(m_gridHorizontalLinesVisible,
-                                            m_gridVerticalLinesVisible,
-                                            m_gridHorizontalSubLinesVisible,
-                                            m_gridVerticalSubLinesVisible));
+    const bool xCalendar = hasCalendarDateTimeTicks(true);
+    const bool yCalendar = hasCalendarDateTimeTicks(false);
+    m_axisGrid->setGridVisibility(QVector4D(m_gridHorizontalLinesVisible && !yCalendar,
+                                            m_gridVerticalLinesVisible && !xCalendar,
+                                            m_gridHorizontalSubLinesVisible && !yCalendar,
+                                            m_gridVerticalSubLinesVisible && !xCalendar));
     m_axisGrid->setVerticalSubGridScale(m_axisVerticalSubGridScale);
     m_axisGrid->setHorizontalSubGridScale(m_axisHorizontalSubGridScale);
 }
@@ -550,6 +563,124 @@ void AxisRenderer::updateAxisGridShadow()
     }
 }
 
+bool AxisRenderer::hasCalendarDateTimeTicks(bool xAxis) const
+{
+    if (xAxis) {
+        return qobject_cast<QDateTimeAxis *>(m_axisHorizontal)
+               && m_axisHorizontalDateTimeTicks.hasCalendarSteps();
+    }
+    return qobject_cast<QDateTimeAxis *>(m_axisVertical)
+           && m_axisVerticalDateTimeTicks.hasCalendarSteps();
+}
+
+// Position of msecs on a date-time axis with calendar steps, in the coordinates of the
+// renderer. Like the grid, the range is mapped inside half of a grid line from the plot
+// area edges.
+qreal AxisRenderer::dateTimeTickPosition(bool xAxis, qint64 msecs)
+{
+    const QRectF &rect = m_graph->m_plotArea;
+    const qreal padding = theme()->grid().mainWidth() * 0.5;
+    const double min = xAxis ? m_axisHorizontalMinValue : m_axisVerticalMinValue;
+    const double range = (xAxis ? m_axisHorizontalMaxValue : m_axisVerticalMaxValue) - min;
+    const qreal fraction = qFuzzyIsNull(range) ? 0.0 : (msecs - min) / range;
+    if (xAxis)
+        return rect.left() + padding + fraction * (rect.width() - 2 * padding);
+    return rect.bottom() - padding - fraction * (rect.height() - 2 * padding);
+}
+
+// Appends the grid lines and ticks of a date-time axis with calendar steps, or their shadows
+void AxisRenderer::addDateTimeLines(bool xAxis, bool shadow, ColoredVertices &vertices)
+{
+    auto axis = qobject_cast<QDateTimeAxis *>(xAxis ? m_axisHorizontal : m_axisVertical);
+    const DateTimeTicks &ticks = xAxis ? m_axisHorizontalDateTimeTicks
+                                       : m_axisVerticalDateTimeTicks;
+    const double min = xAxis ? m_axisHorizontalMinValue : m_axisVerticalMinValue;
+    const double max = xAxis ? m_axisHorizontalMaxValue : m_axisVerticalMaxValue;
+    const QRectF &plot = m_graph->m_plotArea;
+    const QRectF &tickers = xAxis ? m_graph->m_xAxisTickersArea : m_graph->m_yAxisTickersArea;
+    const auto &axisTheme = xAxis ? theme()->axisX() : theme()->axisY();
+    const auto &gridTheme = theme()->grid();
+    const bool gridVisible = xAxis ? m_gridVerticalLinesVisible : m_gridHorizontalLinesVisible;
+    const bool subGridVisible = xAxis ? m_gridVerticalSubLinesVisible
+                                      : m_gridHorizontalSubLinesVisible;
+    const bool tickersVisible = axis->isVisible();
+    const int subTickCount = axis->subTickCount();
+
+    const qreal feather = featherWidth(this);
+    const QPointF offset = shadow ? QPointF(m_graph->shadowXOffset(), m_graph->shadowYOffset())
+                                  : QPointF();
+    const qreal extraWidth = shadow ? m_graph->shadowBarWidth() : 0.0;
+    auto lineColor = [this, shadow](const QColor &color) {
+        return qPremultiply((shadow ? m_graph->shadowColor() : color).rgba());
+    };
+    auto addLine = [&](qreal position, qreal from, qreal to, qreal width, QRgb color) {
+        const QPointF start = xAxis ? QPointF(position, from) : QPointF(from, position);
+        const QPointF end = xAxis ? QPointF(position, to) : QPointF(to, position);
+        strokeLine(start + offset, end + offset, width + extraWidth, feather, color, vertices);
+    };
+
+    // Grid lines span the plot area and ticks the tickers area. Minor ticks are half as
+    // long, next to the axis line.
+    const qreal gridFrom = xAxis ? plot.top() : plot.left();
+    const qreal gridTo = xAxis ? plot.bottom() : plot.right();
+    const qreal tickFrom = xAxis ? tickers.top() : tickers.left();
+    const qreal tickTo = xAxis ? tickers.bottom() : tickers.right();
+    const qreal tickMiddle = (tickFrom + tickTo) * 0.5;
+    const bool axisLineAtFrom = xAxis ? !m_horizontalAxisOnTop : m_verticalAxisOnRight;
+    const qreal subTickFrom = axisLineAtFrom ? tickFrom : tickMiddle;
+    const qreal subTickTo = axisLineAtFrom ? tickMiddle : tickTo;
+
+    const QRgb gridColor = lineColor(gridTheme.mainColor());
+    const QRgb subGridColor = lineColor(gridTheme.subColor());
+    const QRgb tickColor = lineColor(axisTheme.mainColor());
+    const QRgb subTickColor = lineColor(axisTheme.subColor());
+
+    // Minor ticks are also added before the first major tick, in the step before it
+    for (qsizetype i = -1; i < ticks.count; ++i) {
+        const qint64 msecs = ticks.msecsAt(i);
+        if (i >= 0 && msecs >= min && msecs <= max) {
+            const qreal position = dateTimeTickPosition(xAxis, msecs);
+            if (gridVisible)
+                addLine(position, gridFrom, gridTo, gridTheme.mainWidth(), gridColor);
+            if (tickersVisible)
+                addLine(position, tickFrom, tickTo, axisTheme.mainWidth(), tickColor);
+        }
+        if (subTickCount <= 0 || (!subGridVisible && !tickersVisible))
+            continue;
+        const qint64 nextMSecs = ticks.msecsAt(i + 1);
+        for (int k = 1; k <= subTickCount; ++k) {
+            const double subMSecs = msecs + double(nextMSecs - msecs) * k / (subTickCount + 1);
+            if (subMSecs < min || subMSecs > max)
+                continue;
+            const qreal position = dateTimeTickPosition(xAxis, qint64(subMSecs));
+            if (subGridVisible)
+                addLine(position, gridFrom, gridTo, gridTheme.subWidth(), subGridColor);
+            if (tickersVisible)
+                addLine(position, subTickFrom, subTickTo, axisTheme.subWidth(), subTickColor);
+        }
+    }
+}
+
+void AxisRenderer::updateDateTimeLines()
+{
+    const bool xCalendar = hasCalendarDateTimeTicks(true);
+    const bool yCalendar = hasCalendarDateTimeTicks(false);
+    if (!xCalendar && !yCalendar && m_dateTimeLineVertices.isEmpty())
+        return;
+
+    m_dateTimeLineVertices.clear();
+    for (bool shadow : { true, false }) {
+        if (shadow && !m_graph->isShadowVisible())
+            continue;
+        if (xCalendar)
+            addDateTimeLines(true, shadow, m_dateTimeLineVertices);
+        if (yCalendar)
+            addDateTimeLines(false, shadow, m_dateTimeLineVertices);
+    }
+    m_dateTimeLinesDirty = true;
+    update();
+}
+
 void AxisRenderer::updateAxisTitles(const QRectF xAxisRect, const QRectF yAxisRect)
 {
     if (!m_xAxisTitle) {
@@ -616,99 +747,237 @@ void AxisRenderer::updateAxisLabelItems(QList<QQuickItem *> &textItems,
     }
 }
 
+void AxisRenderer::removeAxisLabelItems(QList<QQuickItem *> &textItems)
+{
+    for (auto &item : textItems) {
+        m_labelTextStates.remove(item);
+        item->deleteLater();
+    }
+    textItems.clear();
+}
+
+// Prepares count labels of the x or y axis. Labels without a labelDelegate or rotation
+// are drawn from the label batch of the axis, the others from text items.
+void AxisRenderer::beginAxisLabels(bool xAxis, QAbstractAxis *axis, qsizetype count)
+{
+    const bool batched = !axis->labelDelegate() && qFuzzyIsNull(axis->labelsAngle());
+    auto &textItems = xAxis ? m_xAxisTextItems : m_yAxisTextItems;
+    // See if we need more text items
+    updateAxisLabelItems(textItems, batched ? 0 : count, axis->labelDelegate());
+
+    auto &batch = xAxis ? m_xLabelBatch : m_yLabelBatch;
+    batch.setFont(xAxis ? theme()->axisXLabelFont() : theme()->axisYLabelFont());
+    batch.begin();
+    if (xAxis)
+        m_xLabelsBatched = batched;
+    else
+        m_yLabelsBatched = batched;
+}
+
+void AxisRenderer::endAxisLabels(bool xAxis)
+{
+    auto &batch = xAxis ? m_xLabelBatch : m_yLabelBatch;
+    batch.end();
+    if (batch.isDirty())
+        update();
+}
+
+void AxisRenderer::setAxisLabel(bool xAxis, qsizetype index, const QRectF &rect, qreal angle,
+                                const QString &text, QQuickText::HAlignment hAlign,
+                                QQuickText::VAlignment vAlign)
+{
+    if (xAxis ? m_xLabelsBatched : m_yLabelsBatched) {
+        const QColor color = xAxis ? theme()->axisX().labelTextColor()
+                                   : theme()->axisY().labelTextColor();
+        auto &batch = xAxis ? m_xLabelBatch : m_yLabelBatch;
+        batch.addLabel(text, rect, Qt::Alignment(int(hAlign) | int(vAlign)), color);
+        return;
+    }
+
+    auto &textItem = (xAxis ? m_xAxisTextItems : m_yAxisTextItems)[index];
+    textItem->setX(rect.x());
+    textItem->setY(rect.y());
+    textItem->setWidth(rect.width());
+    textItem->setRotation(angle);
+    setLabelTextProperties(textItem, text, xAxis, hAlign, vAlign);
+    textItem->setHeight(rect.height());
+    textItem->setVisible(true);
+}
+
+void AxisRenderer::hideAxisLabel(bool xAxis, qsizetype index)
+{
+    if (xAxis ? m_xLabelsBatched : m_yLabelsBatched)
+        return;
+    (xAxis ? m_xAxisTextItems : m_yAxisTextItems)[index]->setVisible(false);
+}
+
+QSGNode *AxisRenderer::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *updatePaintNodeData)
+{
+    Q_UNUSED(updatePaintNodeData);
+
+    QSGNode *root = oldNode;
+    const bool recreated = !root;
+    if (recreated) {
+        // Scene graph was (re)initialized, so the lines and labels are added to new nodes
+        root = new QSGNode();
+        root->appendChildNode(ColoredGeometryNodes::createNode());
+        root->appendChildNode(new QSGNode());
+        root->appendChildNode(new QSGNode());
+    }
+
+    if (m_dateTimeLinesDirty || recreated) {
+        m_dateTimeLinesDirty = false;
+        auto node = static_cast<QSGGeometryNode *>(root->firstChild());
+        auto geometry = node->geometry();
+        geometry->allocate(m_dateTimeLineVertices.size());
+        std::copy(m_dateTimeLineVertices.cbegin(),
+                  m_dateTimeLineVertices.cend(),
+                  geometry->vertexDataAsColoredPoint2D());
+        node->markDirty(QSGNode::DirtyGeometry);
+    }
+
+    m_xLabelBatch.updateNode(root->firstChild()->nextSibling(), window(), recreated);
+    m_yLabelBatch.updateNode(root->lastChild(), window(), recreated);
+
+    return root;
+}
+
 void AxisRenderer::setLabelTextProperties(QQuickItem *item, const QString &text, bool xAxis,
                                           QQuickText::HAlignment hAlign, QQuickText::VAlignment vAlign)
 {
+    auto state = m_labelTextStates.find(item);
+    const bool initialized = state != m_labelTextStates.end();
+    if (!initialized)
+        state = m_labelTextStates.insert(item, LabelTextState());
+
     if (auto textItem = qobject_cast<QQuickText *>(item)) {
         // If the component is a Text item (default), then text
         // properties can be set directly.
+        const QFont font = xAxis ? theme()->axisXLabelFont() : theme()->axisYLabelFont();
+        const QColor color = xAxis ? theme()->axisX().labelTextColor()
+                                   : theme()->axisY().labelTextColor();
+        // Unchanged labels don't need to be laid out again
+        if (initialized && state->text == text && state->font == font && state->color == color
+            && state->hAlign == hAlign && state->vAlign == vAlign) {
+            return;
+        }
         textItem->setText(text);
         textItem->setHeight(textItem->contentHeight()); // Default height
         textItem->setHAlign(hAlign);
         textItem->setVAlign(vAlign);
-        if (xAxis) {
-            textItem->setFont(theme()->axisXLabelFont());
-            textItem->setColor(theme()->axisX().labelTextColor());
-        } else {
-            textItem->setFont(theme()->axisYLabelFont());
-            textItem->setColor(theme()->axisY().labelTextColor());
-        }
+        textItem->setFont(font);
+        textItem->setColor(color);
+        *state = { text, font, color, hAlign, vAlign };
     } else {
+        if (initialized && state->text == text)
+            return;
         // Check for specific dynamic properties
         if (item->property("text").isValid())
             item->setProperty("text", text);
+        state->text = text;
+    }
+}
+
+QString AxisRenderer::valueLabelText(LabelTextCache &cache, double value, char format, int decimals)
+{
+    // Negative zero would share the cached text of zero
+    if (value == 0)
+        return QString::number(value, format, decimals);
+
+    if (cache.format != format || cache.decimals != decimals) {
+        cache.values.clear();
+        cache.format = format;
+        cache.decimals = decimals;
+    }
+
+    auto it = cache.values.constFind(value);
+    if (it != cache.values.cend())
+        return *it;
+
+    if (cache.values.size() >= MaxCachedLabelTexts)
+        cache.values.clear();
+    QString text = QString::number(value, format, decimals);
+    cache.values.insert(value, text);
+    return text;
+}
+
+QString AxisRenderer::dateTimeLabelText(LabelTextCache &cache, qint64 msecs,
+                                        const QTimeZone &timeZone, const QString &format)
+{
+    if (cache.dateTimeFormat != format || cache.timeZone != timeZone) {
+        cache.dateTimes.clear();
+        cache.dateTimeFormat = format;
+        cache.timeZone = timeZone;
     }
+
+    auto it = cache.dateTimes.constFind(msecs);
+    if (it != cache.dateTimes.cend())
+        return *it;
+
+    if (cache.dateTimes.size() >= MaxCachedLabelTexts)
+        cache.dateTimes.clear();
+    QString text = QDateTime::fromMSecsSinceEpoch(msecs, timeZone).toString(format);
+    cache.dateTimes.insert(msecs, text);
+    return text;
 }
 
 #ifdef USE_BARGRAPH
 void AxisRenderer::updateBarXAxisLabels(QBarCategoryAxis *axis, const QRectF rect)
 {
     qsizetype categoriesCount = axis->categories().size();
-    // See if we need more text items
-    updateAxisLabelItems(m_xAxisTextItems, categoriesCount, axis->labelDelegate());
+    beginAxisLabels(true, axis, categoriesCount);
 
     int textIndex = 0;
     for (auto category : axis->categories()) {
-        auto &textItem = m_xAxisTextItems[textIndex];
         if (axis->isVisible() && axis->labelsVisible()) {
             float posX = rect.x() + ((float)textIndex / categoriesCount) *  rect.width();
-            textItem->setX(posX);
             float posY = rect.y();
-            textItem->setY(posY);
-            textItem->setWidth(rect.width() / categoriesCount);
-            textItem->setRotation(axis->labelsAngle());
+            const QRectF labelRect(posX, posY, rect.width() / categoriesCount, rect.height());
             if (m_horizontalAxisOnTop) {
-                setLabelTextProperties(textItem, category, true,
-                                       QQuickText::HAlignment::AlignHCenter,
-                                       QQuickText::VAlignment::AlignBottom);
+                setAxisLabel(true, textIndex, labelRect, axis->labelsAngle(), category,
+                             QQuickText::HAlignment::AlignHCenter,
+                             QQuickText::VAlignment::AlignBottom);
             } else {
-                setLabelTextProperties(textItem, category, true,
-                                       QQuickText::HAlignment::AlignHCenter,
-                                       QQuickText::VAlignment::AlignTop);
+                setAxisLabel(true, textIndex, labelRect, axis->labelsAngle(), category,
+                             QQuickText::HAlignment::AlignHCenter,
+                             QQuickText::VAlignment::AlignTop);
             }
-            textItem->setHeight(rect.height());
-            textItem->setVisible(true);
             theme()->dirtyBits()->axisXDirty = false;
         } else {
-            textItem->setVisible(false);
+            hideAxisLabel(true, textIndex);
         }
         textIndex++;
     }
+    endAxisLabels(true);
 }
 
 void AxisRenderer::updateBarYAxisLabels(QBarCategoryAxis *axis, const QRectF rect)
 {
     qsizetype categoriesCount = axis->categories().size();
-    // See if we need more text items
-    updateAxisLabelItems(m_yAxisTextItems, categoriesCount, axis->labelDelegate());
+    beginAxisLabels(false, axis, categoriesCount);
 
     int textIndex = 0;
     for (auto category : axis->categories()) {
-        auto &textItem = m_yAxisTextItems[textIndex];
         if (axis->isVisible() && axis->labelsVisible()) {
             float posX = rect.x();
-            textItem->setX(posX);
             float posY = rect.y() + ((float)textIndex / categoriesCount) *  rect.height();
-            textItem->setY(posY);
-            textItem->setWidth(rect.width());
-            textItem->setRotation(axis->labelsAngle());
+            const QRectF labelRect(posX, posY, rect.width(), rect.height() / categoriesCount);
             if (m_verticalAxisOnRight) {
-                setLabelTextProperties(textItem, category, false,
-                                       QQuickText::HAlignment::AlignRight,
-                                       QQuickText::VAlignment::AlignVCenter);
+                setAxisLabel(false, textIndex, labelRect, axis->labelsAngle(), category,
+                             QQuickText::HAlignment::AlignRight,
+                             QQuickText::VAlignment::AlignVCenter);
             } else {
-                setLabelTextProperties(textItem, category, false,
-                                       QQuickText::HAlignment::AlignLeft,
-                                       QQuickText::VAlignment::AlignVCenter);
+                setAxisLabel(false, textIndex, labelRect, axis->labelsAngle(), category,
+                             QQuickText::HAlignment::AlignLeft,
+                             QQuickText::VAlignment::AlignVCenter);
             }
-            textItem->setHeight(rect.height() / categoriesCount);
-            textItem->setVisible(true);
             theme()->dirtyBits()->axisYDirty = false;
         } else {
-            textItem->setVisible(false);
+            hideAxisLabel(false, textIndex);
         }
         textIndex++;
     }
+    endAxisLabels(false);
 }
 #endif
 
@@ -723,25 +992,18 @@ void AxisRenderer::updateValueYAxisLabels(QValueAxis *axis, const QRectF rect)
             break;
     }
     qsizetype categoriesCount = yAxisLabelValues.size();
-
-    // See if we need more text items
-    updateAxisLabelItems(m_yAxisTextItems, categoriesCount, axis->labelDelegate());
+    beginAxisLabels(false, axis, categoriesCount);
 
     for (int i = 0;  i < categoriesCount; i++) {
-        auto &textItem = m_yAxisTextItems[i];
         if (axis->isVisible() && axis->labelsVisible()) {
             float posX = rect.x();
-            textItem->setX(posX);
             float posY = rect.y() + rect.height() - (((float)i) * m_axisVerticalStepPx) + m_axisYDisplacement;
             const double titleMargin = 0.01;
             if ((posY - titleMargin) > (rect.height() + rect.y()) || (posY + titleMargin) < rect.y()) {
                 // Hide text item which are outside the axis area
-                textItem->setVisible(false);
+                hideAxisLabel(false, i);
                 continue;
             }
-            textItem->setY(posY);
-            textItem->setWidth(rect.width());
-            textItem->setRotation(axis->labelsAngle());
             double number = yAxisLabelValues.at(i);
             // Format the number
             int decimals = axis->labelDecimals();
@@ -749,23 +1011,23 @@ void AxisRenderer::updateValueYAxisLabels(QValueAxis *axis, const QRectF rect)
                 decimals = getValueDecimalsFromRange(m_axisVerticalValueRange);
             const QString f = axis->labelFormat();
             char format = f.isEmpty() ? 'f' : f.front().toLatin1();
-            QString label = QString::number(number, format, decimals);
+            QString label = valueLabelText(m_yLabelTextCache, number, format, decimals);
+            const QRectF labelRect(posX, posY, rect.width(), 0);
             if (m_verticalAxisOnRight) {
-                setLabelTextProperties(textItem, label, false,
-                                       QQuickText::HAlignment::AlignLeft,
-                                       QQuickText::VAlignment::AlignVCenter);
+                setAxisLabel(false, i, labelRect, axis->labelsAngle(), label,
+                             QQuickText::HAlignment::AlignLeft,
+                             QQuickText::VAlignment::AlignVCenter);
             } else {
-                setLabelTextProperties(textItem, label, false,
-                                       QQuickText::HAlignment::AlignRight,
-                                       QQuickText::VAlignment::AlignVCenter);
+                setAxisLabel(false, i, labelRect, axis->labelsAngle(), label,
+                             QQuickText::HAlignment::AlignRight,
+                             QQuickText::VAlignment::AlignVCenter);
             }
-            textItem->setHeight(0);
-            textItem->setVisible(true);
             theme()->dirtyBits()->axisYDirty = false;
         } else {
-            textItem->setVisible(false);
+            hideAxisLabel(false, i);
         }
     }
+    endAxisLabels(false);
 }
 
 void AxisRenderer::updateValueXAxisLabels(QValueAxis *axis, const QRectF rect)
@@ -779,28 +1041,21 @@ void AxisRenderer::updateValueXAxisLabels(QValueAxis *axis, const QRectF rect)
             break;
     }
     qsizetype categoriesCount = axisLabelValues.size();
-
-    // See if we need more text items
-    updateAxisLabelItems(m_xAxisTextItems, categoriesCount, axis->labelDelegate());
+    beginAxisLabels(true, axis, categoriesCount);
 
     for (int i = 0;  i < categoriesCount; i++) {
-        auto &textItem = m_xAxisTextItems[i];
         if (axis->isVisible() && axis->labelsVisible()) {
             float posY = rect.y();
-            textItem->setY(posY);
             float textItemWidth = 20;
             float posX = rect.x() + (((float)i) * m_axisHorizontalStepPx) - m_axisXDisplacement;
             const double titleMargin = 0.01;
             if ((posX - titleMargin) > (rect.width() + rect.x()) || (posX + titleMargin) < rect.x()) {
                 // Hide text item which are outside the axis area
-                textItem->setVisible(false);
+                hideAxisLabel(true, i);
                 continue;
             }
             // Take text size into account only after hiding
             posX -= 0.5 * textItemWidth;
-            textItem->setX(posX);
-            textItem->setWidth(textItemWidth);
-            textItem->setRotation(axis->labelsAngle());
             double number = axisLabelValues.at(i);
             // Format the number
             int decimals = axis->labelDecimals();
@@ -808,116 +1063,106 @@ void AxisRenderer::updateValueXAxisLabels(QValueAxis *axis, const QRectF rect)
                 decimals = getValueDecimalsFromRange(m_axisHorizontalValueRange);
             const QString f = axis->labelFormat();
             char format = f.isEmpty() ? 'f' : f.front().toLatin1();
-            QString label = QString::number(number, format, decimals);
+            QString label = valueLabelText(m_xLabelTextCache, number, format, decimals);
+            const QRectF labelRect(posX, posY, textItemWidth, rect.height());
             if (m_horizontalAxisOnTop) {
-                setLabelTextProperties(textItem, label, true,
-                                       QQuickText::HAlignment::AlignHCenter,
-                                       QQuickText::VAlignment::AlignBottom);
+                setAxisLabel(true, i, labelRect, axis->labelsAngle(), label,
+                             QQuickText::HAlignment::AlignHCenter,
+                             QQuickText::VAlignment::AlignBottom);
             } else {
-                setLabelTextProperties(textItem, label, true,
-                                       QQuickText::HAlignment::AlignHCenter,
-                                       QQuickText::VAlignment::AlignTop);
+                setAxisLabel(true, i, labelRect, axis->labelsAngle(), label,
+                             QQuickText::HAlignment::AlignHCenter,
+                             QQuickText::VAlignment::AlignTop);
             }
-            textItem->setHeight(rect.height());
-            textItem->setVisible(true);
             theme()->dirtyBits()->axisXDirty = false;
         } else {
-            textItem->setVisible(false);
+            hideAxisLabel(true, i);
         }
     }
+    endAxisLabels(true);
 }
 
 void AxisRenderer::updateDateTimeYAxisLabels(QDateTimeAxis *axis, const QRectF rect)
 {
-    auto maxDate = axis->max();
-    auto minDate = axis->min();
-    int dateTimeSize = m_axisVerticalMinLabel + 1;
-    auto segment = (maxDate.toMSecsSinceEpoch() - minDate.toMSecsSinceEpoch())
-                   / m_axisVerticalMinLabel;
-
-    // See if we need more text items
-    updateAxisLabelItems(m_yAxisTextItems, dateTimeSize, axis->labelDelegate());
+    const DateTimeTicks &ticks = m_axisVerticalDateTimeTicks;
+    beginAxisLabels(false, axis, ticks.count);
 
-    for (auto i = 0; i < dateTimeSize; ++i) {
-        auto &textItem = m_yAxisTextItems[i];
+    for (qsizetype i = 0; i < ticks.count; ++i) {
         if (axis->isVisible() && axis->labelsVisible()) {
+            const qint64 msecs = ticks.msecsAt(i);
             float posX = rect.x();
-            textItem->setX(posX);
-            float posY = rect.y() + rect.height() - (((float) i) * m_axisVerticalStepPx);
+            float posY = ticks.hasCalendarSteps()
+                             ? dateTimeTickPosition(false, msecs)
+                             : rect.y() + rect.height()
+                                   - (msecs - m_axisVerticalMinValue) / m_axisVerticalValueStep
+                                         * m_axisVerticalStepPx;
             const double titleMargin = 0.01;
             if ((posY - titleMargin) > (rect.height() + rect.y())
                 || (posY + titleMargin) < rect.y()) {
                 // Hide text item which are outside the axis area
-                textItem->setVisible(false);
+                hideAxisLabel(false, i);
                 continue;
             }
-            textItem->setY(posY);
-            textItem->setWidth(rect.width());
-            textItem->setRotation(axis->labelsAngle());
-            QString label = minDate.addMSecs(segment * i).toString(axis->labelFormat());
+            QString label = dateTimeLabelText(m_yLabelTextCache, msecs, ticks.timeZone,
+                                              axis->labelFormat());
+            const QRectF labelRect(posX, posY, rect.width(), 0);
             if (m_verticalAxisOnRight) {
-                setLabelTextProperties(textItem, label, false,
-                                       QQuickText::HAlignment::AlignLeft,
-                                       QQuickText::VAlignment::AlignVCenter);
+                setAxisLabel(false, i, labelRect, axis->labelsAngle(), label,
+                             QQuickText::HAlignment::AlignLeft,
+                             QQuickText::VAlignment::AlignVCenter);
             } else {
-                setLabelTextProperties(textItem, label, false,
-                                       QQuickText::HAlignment::AlignRight,
-                                       QQuickText::VAlignment::AlignVCenter);
+                setAxisLabel(false, i, labelRect, axis->labelsAngle(), label,
+                             QQuickText::HAlignment::AlignRight,
+                             QQuickText::VAlignment::AlignVCenter);
             }
-            textItem->setHeight(0);
-            textItem->setVisible(true);
         } else {
-            textItem->setVisible(false);
+            hideAxisLabel(false, i);
         }
     }
+    endAxisLabels(false);
 }
 
 void AxisRenderer::updateDateTimeXAxisLabels(QDateTimeAxis *axis, const QRectF rect)
 {
-    auto maxDate = axis->max();
-    auto minDate = axis->min();
-    int dateTimeSize = m_axisHorizontalMinLabel + 1;
-    auto segment = (maxDate.toMSecsSinceEpoch() - minDate.toMSecsSinceEpoch())
-                   / m_axisHorizontalMinLabel;
+    const DateTimeTicks &ticks = m_axisHorizontalDateTimeTicks;
+    beginAxisLabels(true, axis, ticks.count);
 
-    // See if we need more text items
-    updateAxisLabelItems(m_xAxisTextItems, dateTimeSize, axis->labelDelegate());
-
-    for (auto i = 0; i < dateTimeSize; ++i) {
-        auto &textItem = m_xAxisTextItems[i];
+    for (qsizetype i = 0; i < ticks.count; ++i) {
         if (axis->isVisible() && axis->labelsVisible()) {
             float posY = rect.y();
-            textItem->setY(posY);
             float textItemWidth = 20;
-            float posX = rect.x() + (((float) i) * m_axisHorizontalStepPx);
+            const qint64 msecs = ticks.msecsAt(i);
+            float posX = ticks.hasCalendarSteps()
+                             ? dateTimeTickPosition(true, msecs)
+                             : rect.x()
+                                   + (msecs - m_axisHorizontalMinValue) / m_axisHorizontalValueStep
+                                         * m_axisHorizontalStepPx;
             const double titleMargin = 0.01;
             if ((posX - titleMargin) > (rect.width() + rect.x())
                 || (posX + titleMargin) < rect.x()) {
                 // Hide text item which are outside the axis area
-                textItem->setVisible(false);
+                hideAxisLabel(true, i);
                 continue;
             }
             // Take text size into account only after hiding
             posX -= 0.5 * textItemWidth;
-            textItem->setX(posX);
-            textItem->setWidth(textItemWidth);
-            textItem->setRotation(axis->labelsAngle());
-            QString label = minDate.addMSecs(segment * i).toString(axis->labelFormat());
+            QString label = dateTimeLabelText(m_xLabelTextCache, msecs, ticks.timeZone,
+                                              axis->labelFormat());
+            const QRectF labelRect(posX, posY, textItemWidth, rect.height());
             if (m_horizontalAxisOnTop) {
-                setLabelTextProperties(textItem, label, true,
-                                       QQuickText::HAlignment::AlignHCenter,
-                                       QQuickText::VAlignment::AlignBottom);
+                setAxisLabel(true, i, labelRect, axis->labelsAngle(), label,
+                             QQuickText::HAlignment::AlignHCenter,
+                             QQuickText::VAlignment::AlignBottom);
             } else {
-                setLabelTextProperties(textItem, label, true,
-                                       QQuickText::HAlignment::AlignHCenter,
-                                       QQuickText::VAlignment::AlignTop);
+                setAxisLabel(true, i, labelRect, axis->labelsAngle(), label,
+                             QQuickText::HAlignment::AlignHCenter,
+                             QQuickText::VAlignment::AlignTop);
             }
-            textItem->setHeight(rect.height());
-            textItem->setVisible(true);
         } else {
-            textItem->setVisible(false);
+            hideAxisLabel(true, i);
         }
     }
+    endAxisLabels(true);
 }
 
 // Calculate suitable major step based on range
@@ -17,11 +17,16 @@
 #include <QQuickItem>
 #include <QRectF>
 #include <QList>
-#include <QList>
+#include <QHash>
+#include <QDateTime>
+#include <QTimeZone>
 #include <QtQuick/private/qquicktext_p.h>
 #include <private/axisgrid_p.h>
 #include <private/axisticker_p.h>
 #include <private/axisline_p.h>
+#include <private/coloredgeometry_p.h>
+#include <private/datetimeticks_p.h>
+#include <private/labelbatch_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -54,8 +59,12 @@ public:
     void updateValueXAxisLabels(QValueAxis *axis, const QRectF rect);
     void updateDateTimeYAxisLabels(QDateTimeAxis *axis, const QRectF rect);
     void updateDateTimeXAxisLabels(QDateTimeAxis *axis, const QRectF rect);
+    void updateDateTimeLines();
     void initialize();
 
+protected:
+    QSGNode *updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *updatePaintNodeData) override;
+
 Q_SIGNALS:
 
 private:
@@ -64,6 +73,7 @@ private:
     friend class LinesRenderer;
     friend class PointRenderer;
     friend class AreaRenderer;
+    friend class tst_datetimeaxis;
 
     double getValueStepsFromRange(double range);
     int getValueDecimalsFromRange(double range);
@@ -71,6 +81,46 @@ private:
                                 QQuickText::HAlignment hAlign = QQuickText::HAlignment::AlignHCenter,
                                 QQuickText::VAlignment vAlign = QQuickText::VAlignment::AlignVCenter);
     void updateAxisLabelItems(QList<QQuickItem *> &textItems, qsizetype neededSize, QQmlComponent *component);
+    void removeAxisLabelItems(QList<QQuickItem *> &textItems);
+    void beginAxisLabels(bool xAxis, QAbstractAxis *axis, qsizetype count);
+    void endAxisLabels(bool xAxis);
+    void setAxisLabel(bool xAxis, qsizetype index, const QRectF &rect, qreal angle,
+                      const QString &text, QQuickText::HAlignment hAlign,
+                      QQuickText::VAlignment vAlign);
+    void hideAxisLabel(bool xAxis, qsizetype index);
+
+    // Date-time axes with calendar steps have ticks at uneven distances, which the grid and
+    // ticker shaders can't draw. Their grid lines and ticks are drawn as geometry instead,
+    // and their labels are placed at the same positions.
+    bool hasCalendarDateTimeTicks(bool xAxis) const;
+    qreal dateTimeTickPosition(bool xAxis, qint64 msecs);
+    void addDateTimeLines(bool xAxis, bool shadow, ColoredVertices &vertices);
+
+    // Formatted label texts of one axis direction. While the axis is panned most
+    // labels keep their value, so their texts are reused instead of formatted again.
+    struct LabelTextCache
+    {
+        char format = 0;
+        int decimals = -1;
+        QHash<double, QString> values;
+        QString dateTimeFormat;
+        QTimeZone timeZone;
+        QHash<qint64, QString> dateTimes;
+    };
+    static constexpr qsizetype MaxCachedLabelTexts = 1000;
+    QString valueLabelText(LabelTextCache &cache, double value, char format, int decimals);
+    QString dateTimeLabelText(LabelTextCache &cache, qint64 msecs, const QTimeZone &timeZone,
+                              const QString &format);
+
+    // Contents last set to a label item, used to skip the text layout of unchanged labels
+    struct LabelTextState
+    {
+        QString text;
+        QFont font;
+        QColor color;
+        QQuickText::HAlignment hAlign = QQuickText::HAlignment::AlignHCenter;
+        QQuickText::VAlignment vAlign = QQuickText::VAlignment::AlignVCenter;
+    };
 
     QGraphsView *m_graph = nullptr;
     QGraphsTheme *theme();
@@ -83,6 +133,16 @@ private:
     QAbstractAxis *m_axisHorizontal = nullptr;
     QList<QQuickItem *> m_xAxisTextItems;
     QList<QQuickItem *> m_yAxisTextItems;
+    QHash<QQuickItem *, LabelTextState> m_labelTextStates;
+    LabelTextCache m_xLabelTextCache;
+    LabelTextCache m_yLabelTextCache;
+    // Default labels are drawn from one text node per axis instead of text items
+    LabelBatch m_xLabelBatch;
+    LabelBatch m_yLabelBatch;
+    bool m_xLabelsBatched = false;
+    bool m_yLabelsBatched = false;
+    ColoredVertices m_dateTimeLineVertices;
+    bool m_dateTimeLinesDirty = false;
     QQuickText *m_xAxisTitle = nullptr;
     QQuickText *m_yAxisTitle = nullptr;
     AxisGrid *m_axisGrid = nullptr;
@@ -113,6 +173,8 @@ private:
     double m_axisYDisplacement = 0;
     // The value of smallest label
     double m_axisVerticalMinLabel = 0;
+    // Ticks of a date-time axis
+    DateTimeTicks m_axisVerticalDateTimeTicks;
 
 
     // Horizontal axis
@@ -130,6 +192,8 @@ private:
     double m_axisXDisplacement = 0;
     // The value of smallest label
     double m_axisHorizontalMinLabel = 0;
+    // Ticks of a date-time axis
+    DateTimeTicks m_axisHorizontalDateTimeTicks;
 
     double m_axisVerticalSubGridScale = 0.5;
     double m_axisHorizontalSubGridScale = 0.5;
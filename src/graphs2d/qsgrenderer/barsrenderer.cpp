@@ -1,13 +1,18 @@
 // Copyright (C) 2023 The Qt Company Ltd.
 // SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
 
-#include <QtQuick/private/qquickrectangle_p.h>
 #include <QtGraphs/qbarseries.h>
 #include <QtGraphs/qbarset.h>
 #include <private/barsrenderer_p.h>
 #include <private/axisrenderer_p.h>
 #include <private/qbarseries_p.h>
 #include <private/qgraphsview_p.h>
+#include <QtCore/qmath.h>
+#include <QtGui/qrgb.h>
+#include <QtQuick/QSGGeometryNode>
+
+#include <array>
+#include <limits>
 
 QT_BEGIN_NAMESPACE
 
@@ -19,6 +24,15 @@ static const char* TAG_BAR_VALUE = "barValue";
 static const char* TAG_BAR_LABEL = "barLabel";
 static const char* TAG_BAR_INDEX = "barIndex";
 
+// Default bars look like a Rectangle with a radius of 4 and a border. Each bar is a fill fan
+// inside of rings between its rounded outlines: an antialiasing ring fading out across the
+// outer edge, the border, and a ring blending the border into the fill across the inner edge.
+static constexpr qreal barRadius = 4.0;
+static constexpr int barCornerSegments = 4;
+static constexpr int barOutlinePoints = 4 * (barCornerSegments + 1);
+static constexpr int verticesPerBar = 4 * barOutlinePoints + 1;
+static constexpr int indicesPerBar = 21 * barOutlinePoints;
+
 BarsRenderer::BarsRenderer(QGraphsView *graph)
     : QQuickItem(graph)
     , m_graph(graph)
@@ -27,7 +41,10 @@ BarsRenderer::BarsRenderer(QGraphsView *graph)
     setClip(true);
 }
 
-BarsRenderer::~BarsRenderer() {}
+BarsRenderer::~BarsRenderer()
+{
+    qDeleteAll(m_labelBatches);
+}
 
 // Returns color in this order:
 // 1) QBarSet::color if that is defined (alpha > 0).
@@ -96,70 +113,96 @@ QString BarsRenderer::generateLabelText(QBarSeries *series, qreal value)
     return valueLabel;
 }
 
-void BarsRenderer::positionLabelItem(QBarSeries *series, QQuickText *textItem, const BarSeriesData &d)
+// Returns the rect of the value label of the bar of d, with contents of textSize
+QRectF BarsRenderer::valueLabelRect(QBarSeries *series, QSizeF textSize, const BarSeriesData &d)
 {
     auto pos = series->labelsPosition();
     const bool vertical = m_graph->orientation() == Qt::Orientation::Vertical;
-    const float w = textItem->contentWidth() + series->labelsMargin() * 2;
-    const float h = textItem->contentHeight() + series->labelsMargin() * 2;
-    textItem->setWidth(w);
-    textItem->setHeight(h);
-    textItem->setHAlign(QQuickText::HAlignment::AlignHCenter);
-    textItem->setVAlign(QQuickText::VAlignment::AlignVCenter);
+    const float w = textSize.width() + series->labelsMargin() * 2;
+    const float h = textSize.height() + series->labelsMargin() * 2;
+    QPointF position;
     if (pos == QBarSeries::LabelsPosition::Center) {
-        textItem->setX(d.rect.x() + d.rect.width() * 0.5 - w * 0.5);
-        textItem->setY(d.rect.y() + d.rect.height() * 0.5 - h * 0.5);
+        position = QPointF(d.rect.x() + d.rect.width() * 0.5 - w * 0.5,
+                           d.rect.y() + d.rect.height() * 0.5 - h * 0.5);
     } else if (pos == QBarSeries::LabelsPosition::InsideEnd) {
         if (vertical) {
-            textItem->setX(d.rect.x() + d.rect.width() * 0.5 - w * 0.5);
-            textItem->setY(d.rect.y());
+            position = QPointF(d.rect.x() + d.rect.width() * 0.5 - w * 0.5, d.rect.y());
         } else {
-            textItem->setX(d.rect.x() + d.rect.width() - w);
-            textItem->setY(d.rect.y() + d.rect.height() * 0.5 - h * 0.5);
+            position = QPointF(d.rect.x() + d.rect.width() - w,
+                               d.rect.y() + d.rect.height() * 0.5 - h * 0.5);
         }
     } else if (pos == QBarSeries::LabelsPosition::InsideBase) {
         if (vertical) {
-            textItem->setX(d.rect.x() + d.rect.width() * 0.5 - w * 0.5);
-            textItem->setY(d.rect.y() + d.rect.height() - h);
+            position = QPointF(d.rect.x() + d.rect.width() * 0.5 - w * 0.5,
+                               d.rect.y() + d.rect.height() - h);
         } else {
-            textItem->setX(d.rect.x());
-            textItem->setY(d.rect.y() + d.rect.height() * 0.5 - h * 0.5);
+            position = QPointF(d.rect.x(), d.rect.y() + d.rect.height() * 0.5 - h * 0.5);
         }
     } else {
         // OutsideEnd
         if (vertical) {
-            textItem->setX(d.rect.x() + d.rect.width() * 0.5 - w * 0.5);
-            textItem->setY(d.rect.y() - h);
+            position = QPointF(d.rect.x() + d.rect.width() * 0.5 - w * 0.5, d.rect.y() - h);
         } else {
-            textItem->setX(d.rect.x() + d.rect.width());
-            textItem->setY(d.rect.y() + d.rect.height() * 0.5 - h * 0.5);
+            position = QPointF(d.rect.x() + d.rect.width(),
+                               d.rect.y() + d.rect.height() * 0.5 - h * 0.5);
         }
     }
+    return QRectF(position, QSizeF(w, h));
+}
+
+QColor BarsRenderer::valueLabelColor(const BarSeriesData &d) const
+{
+    QColor labelColor = d.labelColor;
+    if (labelColor.alpha() == 0) {
+        // TODO: Use graphs theme labels color.
+        labelColor = QColor(255, 255, 255);
+    }
+    return labelColor;
+}
+
+void BarsRenderer::positionLabelItem(QBarSeries *series, QQuickText *textItem, const BarSeriesData &d)
+{
+    const QRectF rect = valueLabelRect(series,
+                                       QSizeF(textItem->contentWidth(), textItem->contentHeight()),
+                                       d);
+    textItem->setWidth(rect.width());
+    textItem->setHeight(rect.height());
+    textItem->setHAlign(QQuickText::HAlignment::AlignHCenter);
+    textItem->setVAlign(QQuickText::VAlignment::AlignVCenter);
+    textItem->setX(rect.x());
+    textItem->setY(rect.y());
     textItem->update();
 }
 
 void BarsRenderer::updateComponents(QBarSeries *series)
 {
+    auto &barItems = m_barItems[series];
+    // Default bars are drawn by the bar node of the series
+    m_dirtyBarNodes.insert(series);
+    update();
+    if (!series->barDelegate()) {
+        for (auto item : std::as_const(barItems))
+            item->deleteLater();
+        barItems.clear();
+        return;
+    }
+
     int barIndex = 0;
     auto &seriesData = m_seriesData[series];
-    auto &barItems = m_barItems[series];
     for (auto i = seriesData.cbegin(), end = seriesData.cend(); i != end; ++i) {
         if (barItems.size() <= barIndex) {
-            QQuickItem *item = nullptr;
             // Create more components as needed
-            if (series->barDelegate()) {
-                item = qobject_cast<QQuickItem *>(
-                        series->barDelegate()->create(series->barDelegate()->creationContext()));
-            }
+            QQuickItem *item = qobject_cast<QQuickItem *>(
+                    series->barDelegate()->create(series->barDelegate()->creationContext()));
             if (!item)
-                item = new QQuickRectangle();
+                break;
             item->setParent(this);
             item->setParentItem(this);
             barItems << item;
         }
         if (barItems.size() > barIndex) {
             BarSeriesData d = *i;
-            if (series->barDelegate()) {
+            {
                 // Set custom bar components
                 auto &barItem = barItems[barIndex];
                 barItem->setX(d.rect.x());
@@ -182,30 +225,193 @@ void BarsRenderer::updateComponents(QBarSeries *series)
                     barItem->setProperty(TAG_BAR_LABEL, d.label);
                 if (barItem->property(TAG_BAR_INDEX).isValid())
                     barItem->setProperty(TAG_BAR_INDEX, barIndex);
-            } else {
-                // Set default rectangle bars
-                auto barItem = qobject_cast<QQuickRectangle *>(barItems[barIndex]);
-                if (barItem) {
-                    barItem->setX(d.rect.x());
-                    barItem->setY(d.rect.y());
-                    barItem->setWidth(d.rect.width());
-                    barItem->setHeight(d.rect.height());
-                    barItem->setVisible(series->isVisible());
-                    barItem->setColor(d.color);
-                    barItem->border()->setColor(d.borderColor);
-                    barItem->border()->setWidth(d.borderWidth);
-                    barItem->setRadius(4.0);
-                }
             }
         }
         barIndex++;
     }
 }
 
+// Rounded outline of rect, clockwise from the left end of the top-left corner
+static void roundedRectOutline(const QRectF &rect, qreal radius, QPointF *outline)
+{
+    static const auto directions = [] {
+        std::array<QPointF, barOutlinePoints> directions;
+        for (int corner = 0, k = 0; corner < 4; ++corner) {
+            for (int i = 0; i <= barCornerSegments; ++i, ++k) {
+                const qreal angle = M_PI * (1.0 + (corner + qreal(i) / barCornerSegments) * 0.5);
+                directions[k] = QPointF(qCos(angle), qSin(angle));
+            }
+        }
+        return directions;
+    }();
+
+    const QPointF centers[4] = {
+        QPointF(rect.left() + radius, rect.top() + radius),
+        QPointF(rect.right() - radius, rect.top() + radius),
+        QPointF(rect.right() - radius, rect.bottom() - radius),
+        QPointF(rect.left() + radius, rect.bottom() - radius),
+    };
+    for (int k = 0; k < barOutlinePoints; ++k)
+        outline[k] = centers[k / (barCornerSegments + 1)] + radius * directions[k];
+}
+
+void BarsRenderer::updateBarNode(QSGNode *root, QBarSeries *series)
+{
+    const auto &seriesData = m_seriesData[series];
+    const qsizetype barCount = !series->barDelegate() && series->isVisible() ? seriesData.size()
+                                                                              : 0;
+    if (barCount == 0) {
+        m_barNodes.deleteNode(series);
+        return;
+    }
+
+    auto node = m_barNodes.node(root, series);
+    auto geometry = node->geometry();
+    geometry->allocate(barCount * verticesPerBar, barCount * indicesPerBar);
+    auto vertices = geometry->vertexDataAsColoredPoint2D();
+    auto indices = geometry->indexDataAsUInt();
+
+    const qreal feather = featherWidth(this);
+    QPointF fringe[barOutlinePoints];
+    QPointF outer[barOutlinePoints];
+    QPointF border[barOutlinePoints];
+    QPointF inner[barOutlinePoints];
+    for (qsizetype i = 0; i < barCount; ++i) {
+        const BarSeriesData &d = seriesData.at(i);
+        const QRgb color = qPremultiply(d.color.rgba());
+        const QRgb borderColor = qPremultiply(d.borderColor.rgba());
+        // Bars with a negative size are not drawn, like with a Rectangle
+        const QRectF rect = d.rect.width() > 0 && d.rect.height() > 0
+                                ? d.rect
+                                : QRectF(d.rect.topLeft(), QSizeF(0, 0));
+        const qreal halfSize = qMin(rect.width(), rect.height()) / 2.0;
+        const qreal radius = qMin(barRadius, halfSize);
+        const qreal borderWidth = qBound(0.0, qreal(d.borderWidth), halfSize);
+        // The edges fade across the outlines of the Rectangle, half of the feather width on
+        // each side. Without a border the rings inside of the outer edge have no width.
+        const qreal halfFeather = qMin(feather * 0.5, halfSize);
+        const qreal outerInset = halfFeather;
+        const qreal borderInset = borderWidth > 0 ? qMax(borderWidth - halfFeather, outerInset)
+                                                  : outerInset;
+        const qreal innerInset = borderWidth > 0 ? qMin(borderWidth + halfFeather, halfSize)
+                                                 : outerInset;
+        auto outline = [&rect, radius](qreal inset, QPointF *points) {
+            roundedRectOutline(rect.adjusted(inset, inset, -inset, -inset),
+                               qMax(0.0, radius - inset),
+                               points);
+        };
+        outline(-halfFeather, fringe);
+        outline(outerInset, outer);
+        outline(borderInset, border);
+        outline(innerInset, inner);
+        const QRgb edgeColor = borderWidth > 0 ? borderColor : color;
+
+        auto v = vertices + i * verticesPerBar;
+        for (int k = 0; k < barOutlinePoints; ++k) {
+            setColoredVertex(v + k, fringe[k], edgeColor, 0.0);
+            setColoredVertex(v + barOutlinePoints + k, outer[k], edgeColor);
+            setColoredVertex(v + 2 * barOutlinePoints + k, border[k], edgeColor);
+            setColoredVertex(v + 3 * barOutlinePoints + k, inner[k], color);
+        }
+        setColoredVertex(v + 4 * barOutlinePoints, rect.center(), color);
+
+        const quint32 base = quint32(i * verticesPerBar);
+        const quint32 center = base + 4 * barOutlinePoints;
+        auto idx = indices + i * indicesPerBar;
+        for (quint32 k = 0; k < quint32(barOutlinePoints); ++k) {
+            const quint32 next = (k + 1) % barOutlinePoints;
+            // Antialiasing, border and blending rings from the outside in
+            for (quint32 ring = 0; ring < 3; ++ring) {
+                const quint32 ringBase = base + ring * barOutlinePoints;
+                const quint32 innerBase = ringBase + barOutlinePoints;
+                *idx++ = ringBase + k;
+                *idx++ = ringBase + next;
+                *idx++ = innerBase + k;
+                *idx++ = innerBase + k;
+                *idx++ = ringBase + next;
+                *idx++ = innerBase + next;
+            }
+            // Fill
+            *idx++ = center;
+            *idx++ = base + 3 * barOutlinePoints + k;
+            *idx++ = base + 3 * barOutlinePoints + next;
+        }
+    }
+
+    node->markDirty(QSGNode::DirtyGeometry);
+}
+
+QSGNode *BarsRenderer::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *updatePaintNodeData)
+{
+    Q_UNUSED(updatePaintNodeData);
+
+    QSGNode *root = oldNode;
+    const bool recreated = !root;
+    if (recreated) {
+        // Scene graph was (re)initialized, so any earlier label nodes are gone
+        root = new QSGNode();
+        // Value labels of all series are drawn on top of the bars
+        root->appendChildNode(new QSGNode());
+        root->appendChildNode(new QSGNode());
+        m_removedLabelNodes.clear();
+        m_labelNodes.clear();
+    }
+    QSGNode *barsRoot = root->firstChild();
+    QSGNode *labelsRoot = root->lastChild();
+
+    m_barNodes.sync(recreated);
+    for (auto node : std::as_const(m_removedLabelNodes)) {
+        labelsRoot->removeChildNode(node);
+        delete node;
+    }
+    m_removedLabelNodes.clear();
+
+    for (auto it = m_seriesData.cbegin(); it != m_seriesData.cend(); ++it) {
+        if (recreated || m_dirtyBarNodes.contains(it.key()))
+            updateBarNode(barsRoot, it.key());
+    }
+    m_dirtyBarNodes.clear();
+
+    for (auto it = m_labelBatches.cbegin(); it != m_labelBatches.cend(); ++it) {
+        auto node = m_labelNodes.value(it.key());
+        const bool created = !node;
+        if (created) {
+            node = new QSGNode();
+            labelsRoot->appendChildNode(node);
+            m_labelNodes.insert(it.key(), node);
+        }
+        it.value()->updateNode(node, window(), created);
+    }
+
+    return root;
+}
+
 void BarsRenderer::updateValueLabels(QBarSeries *series)
 {
-    if (!series->barDelegate() && series->isVisible() && series->labelsVisible()) {
-        // Update default value labels
+    auto &labelBatch = m_labelBatches[series];
+    if (!labelBatch)
+        labelBatch = new LabelBatch();
+    labelBatch->begin();
+
+    const bool labelsVisible = !series->barDelegate() && series->isVisible()
+                               && series->labelsVisible();
+    // Labels without rotation are drawn from the label batch of the series
+    const bool batched = qFuzzyIsNull(series->labelsAngle());
+    if (labelsVisible && batched) {
+        for (const auto &d : std::as_const(m_seriesData[series])) {
+            if (qFuzzyIsNull(d.value))
+                continue;
+            const QString valueLabel = generateLabelText(series, d.value);
+            const QRectF rect = valueLabelRect(series, labelBatch->textSize(valueLabel), d);
+            labelBatch->addLabel(valueLabel, rect, Qt::AlignCenter, valueLabelColor(d));
+        }
+    }
+    labelBatch->end();
+    if (labelBatch->isDirty())
+        update();
+
+    if (labelsVisible && !batched) {
+        // Update default value label items
         int barIndex = 0;
         auto &seriesData = m_seriesData[series];
         auto &labelTextItems = m_labelTextItems[series];
@@ -226,12 +432,7 @@ void BarsRenderer::updateValueLabels(QBarSeries *series)
                     QString valueLabel = generateLabelText(series, d.value);
                     textItem->setText(valueLabel);
                     positionLabelItem(series, textItem, d);
-                    QColor labelColor = d.labelColor;
-                    if (labelColor.alpha() == 0) {
-                        // TODO: Use graphs theme labels color.
-                        labelColor = QColor(255, 255, 255);
-                    }
-                    textItem->setColor(labelColor);
+                    textItem->setColor(valueLabelColor(d));
                     textItem->setRotation(series->labelsAngle());
                 }
             }
@@ -245,18 +446,62 @@ void BarsRenderer::updateValueLabels(QBarSeries *series)
     }
 }
 
-void calculateCategoryTotalValues(QBarSeries *series, QList<float> &totalValues, qsizetype valuesPerSet)
+// Returns the sums of the values in each category, used by stacked percent bars. The sums are
+// cached, and only the categories changed since the last polish are summed again.
+const QList<float> &BarsRenderer::categoryTotals(QBarSeries *series, qsizetype valuesPerSet)
 {
-    totalValues.fill(0, valuesPerSet);
-    for (auto s : series->barSets()) {
-        QVariantList v = s->values();
-        int setIndex = 0;
-        for (auto variantValue : std::as_const(v)) {
-            if (setIndex < totalValues.size())
-                totalValues[setIndex] += variantValue.toReal();
-            setIndex++;
+    auto &cache = m_categoryTotals[series];
+    const auto barSets = series->barSets();
+    if (cache.barSets != barSets) {
+        for (const auto &connection : std::as_const(cache.connections))
+            QObject::disconnect(connection);
+        cache.connections.clear();
+        auto markFrom = [this, series](qsizetype index) {
+            auto it = m_categoryTotals.find(series);
+            if (it != m_categoryTotals.end())
+                it->dirtyFrom = qMin(it->dirtyFrom, index);
+        };
+        auto markCategory = [this, series](qsizetype index) {
+            auto it = m_categoryTotals.find(series);
+            if (it != m_categoryTotals.end())
+                it->dirtyCategories << index;
+        };
+        for (auto set : barSets) {
+            cache.connections << QObject::connect(set, &QBarSet::valuesAdded, this, markFrom)
+                              << QObject::connect(set, &QBarSet::valuesRemoved, this, markFrom)
+                              << QObject::connect(set, &QBarSet::valueChanged, this, markCategory)
+                              << QObject::connect(set, &QBarSet::valuesChanged, this,
+                                                  [markFrom]() { markFrom(0); });
+        }
+        cache.barSets = barSets;
+        cache.dirtyFrom = 0;
+    }
+
+    auto &totals = cache.totals;
+    const qsizetype from = qMin(cache.dirtyFrom, totals.size());
+    totals.resize(valuesPerSet);
+    if (from < valuesPerSet) {
+        std::fill(totals.begin() + from, totals.end(), 0.0f);
+        for (auto set : barSets) {
+            const auto values = set->valuesSpan();
+            for (qsizetype i = from; i < qMin(values.size(), valuesPerSet); ++i)
+                totals[i] += values[i];
         }
     }
+    for (const qsizetype category : std::as_const(cache.dirtyCategories)) {
+        if (category < 0 || category >= qMin(from, valuesPerSet))
+            continue;
+        float total = 0;
+        for (auto set : barSets) {
+            const auto values = set->valuesSpan();
+            if (category < values.size())
+                total += values[category];
+        }
+        totals[category] = total;
+    }
+    cache.dirtyCategories.clear();
+    cache.dirtyFrom = std::numeric_limits<qsizetype>::max();
+    return totals;
 }
 
 void BarsRenderer::updateVerticalBars(QBarSeries *series, qsizetype setCount, qsizetype valuesPerSet)
@@ -285,20 +530,24 @@ void BarsRenderer::updateVerticalBars(QBarSeries *series, qsizetype setCount, qs
     rectNodesInputRects.clear();
     seriesData.clear();
 
+    if (series->isSelectable() || series->isHoverable())
+        m_barLayouts[series] = {true, stacked, w / valuesPerSet, barCentering, barWidth + m_barMargin};
+    else
+        m_barLayouts.remove(series);
+
     float seriesPos = 0;
     float posXInSet = 0;
     QList<float> posYListInSet;
     if (stacked)
         posYListInSet.fill(0, valuesPerSet);
-    QList<float> totalValuesListInSet;
-    if (percent)
-        calculateCategoryTotalValues(series, totalValuesListInSet, valuesPerSet);
+    const QList<float> totalValuesListInSet = percent ? categoryTotals(series, valuesPerSet)
+                                                      : QList<float>();
 
     int barIndexInSet = 0;
     int barSeriesIndex = 0;
     QList<QLegendData> legendDataList;
     for (auto s : series->barSets()) {
-        QVariantList v = s->values();
+        const auto v = s->valuesSpan();
         qsizetype valuesCount = v.size();
         if (valuesCount == 0)
             continue;
@@ -326,8 +575,7 @@ void BarsRenderer::updateVerticalBars(QBarSeries *series, qsizetype setCount, qs
         color.setAlpha(color.alpha() * series->opacity());
         borderColor.setAlpha(borderColor.alpha() * series->opacity());
         const auto selectedBars = s->selectedBars();
-        for (auto variantValue : std::as_const(v)) {
-            const float realValue = variantValue.toReal();
+        for (const float realValue : v) {
             float value = (realValue - m_graph->m_axisRenderer->m_axisVerticalMinValue) * series->valuesMultiplier();
             if (percent) {
                 if (auto totalValue = totalValuesListInSet.at(barIndexInSet))
@@ -396,19 +644,23 @@ void BarsRenderer::updateHorizontalBars(QBarSeries *series, qsizetype setCount,
     rectNodesInputRects.clear();
     seriesData.clear();
 
+    if (series->isSelectable() || series->isHoverable())
+        m_barLayouts[series] = {false, stacked, h / valuesPerSet, barCentering, barWidth + m_barMargin};
+    else
+        m_barLayouts.remove(series);
+
     float seriesPos = 0;
     float posYInSet = 0;
     QList<float> posXListInSet;
     if (stacked)
         posXListInSet.fill(0, valuesPerSet);
-    QList<float> totalValuesListInSet;
-    if (percent)
-        calculateCategoryTotalValues(series, totalValuesListInSet, valuesPerSet);
+    const QList<float> totalValuesListInSet = percent ? categoryTotals(series, valuesPerSet)
+                                                      : QList<float>();
     int barIndexInSet = 0;
     int barSerieIndex = 0;
     QList<QLegendData> legendDataList;
     for (auto s : series->barSets()) {
-        QVariantList v = s->values();
+        const auto v = s->valuesSpan();
         qsizetype valuesCount = v.size();
         if (valuesCount == 0)
             continue;
@@ -435,8 +687,7 @@ void BarsRenderer::updateHorizontalBars(QBarSeries *series, qsizetype setCount,
         color.setAlpha(color.alpha() * series->opacity());
         borderColor.setAlpha(borderColor.alpha() * series->opacity());
         const auto selectedBars = s->selectedBars();
-        for (auto variantValue : std::as_const(v)) {
-            const float realValue = variantValue.toReal();
+        for (const float realValue : v) {
             float value = (realValue - m_graph->m_axisRenderer->m_axisHorizontalMinValue) * series->valuesMultiplier();
             if (percent) {
                 if (auto totalValue = totalValuesListInSet.at(barIndexInSet))
@@ -500,6 +751,10 @@ void BarsRenderer::handlePolish(QBarSeries *series)
         series->d_func()->clearLegendData();
         rectNodesInputRects.clear();
         seriesData.clear();
+        if (auto labelBatch = m_labelBatches.value(series))
+            labelBatch->clear();
+        m_dirtyBarNodes.insert(series);
+        update();
         return;
     }
 
@@ -516,7 +771,7 @@ void BarsRenderer::handlePolish(QBarSeries *series)
     }
 
     // Get bars values
-    qsizetype valuesPerSet = series->barSets().first()->values().size();
+    qsizetype valuesPerSet = series->barSets().first()->count();
     if (m_graph->orientation() == Qt::Orientation::Vertical)
         updateVerticalBars(series, setCount, valuesPerSet);
     else
@@ -562,25 +817,78 @@ void BarsRenderer::afterPolish(QList<QAbstractSeries *> &cleanupSeries)
             labelTextItems.clear();
             m_labelTextItems.remove(series);
         }
+        if (series) {
+            if (m_barNodes.release(series))
+                update();
+            delete m_labelBatches.take(series);
+            if (auto node = m_labelNodes.take(series)) {
+                m_removedLabelNodes << node;
+                update();
+            }
+            m_dirtyBarNodes.remove(series);
+            m_seriesData.remove(series);
+            m_rectNodesInputRects.remove(series);
+            m_barLayouts.remove(series);
+            if (m_categoryTotals.contains(series)) {
+                for (const auto &connection : std::as_const(m_categoryTotals[series].connections))
+                    QObject::disconnect(connection);
+                m_categoryTotals.remove(series);
+            }
+            if (m_currentHoverSeries == series)
+                m_currentHoverSeries = nullptr;
+        }
     }
 }
 
+// Finds the category under position and the range of selection rects which can contain it.
+// Stacked bars of a category share the same place on the category axis, so all of them are
+// candidates. Grouped bars sit side by side, so only the bar set slot under position is.
+bool BarsRenderer::barCandidates(QBarSeries *series, QPointF position, qsizetype *category,
+                                 qsizetype *firstSelection, qsizetype *endSelection) const
+{
+    const auto layout = m_barLayouts.find(series);
+    if (layout == m_barLayouts.cend() || !(layout->categorySize > 0))
+        return false;
+
+    const qreal pos = layout->vertical ? position.x() : position.y();
+    if (pos < 0)
+        return false;
+    *category = qsizetype(pos / layout->categorySize);
+    *firstSelection = 0;
+    *endSelection = m_rectNodesInputRects.value(series).size();
+    if (!layout->stacked && layout->barStride > 0) {
+        const qreal posInCategory = pos - *category * layout->categorySize - layout->barCentering;
+        if (posInCategory < 0)
+            return false;
+        const qsizetype slot = qsizetype(posInCategory / layout->barStride);
+        if (slot >= *endSelection)
+            return false;
+        *firstSelection = slot;
+        *endSelection = slot + 1;
+    }
+    return true;
+}
+
 bool BarsRenderer::handleMousePress(QMouseEvent *event)
 {
     bool handled = false;
-    for (auto &rectNodesInputRects : m_rectNodesInputRects) {
-        for (auto &barSelection : rectNodesInputRects) {
-            if (!barSelection.series->isSelectable())
-                continue;
-            qsizetype indexInSet = 0;
-            for (auto &rect : barSelection.rects) {
-                if (rect.contains(event->pos())) {
-                    // TODO: Currently just toggling selection
-                    QList<qsizetype> indexList = {indexInSet};
-                    barSelection.barSet->toggleSelection(indexList);
-                    handled = true;
-                }
-                indexInSet++;
+    const QPointF position = event->position();
+    for (auto it = m_rectNodesInputRects.begin(); it != m_rectNodesInputRects.end(); ++it) {
+        if (!it.key()->isSelectable())
+            continue;
+        qsizetype indexInSet = 0;
+        qsizetype first = 0;
+        qsizetype end = 0;
+        if (!barCandidates(it.key(), position, &indexInSet, &first, &end))
+            continue;
+        for (qsizetype i = first; i < end; ++i) {
+            auto &barSelection = it.value()[i];
+            if (indexInSet < barSelection.rects.size()
+                && barSelection.rects.at(indexInSet).contains(position)) {
+                // TODO: Currently just toggling selection
+                QList<qsizetype> indexList = {indexInSet};
+                barSelection.barSet->toggleSelection(indexList);
+                handled = true;
             }
         }
     }
@@ -592,26 +900,29 @@ bool BarsRenderer::handleHoverMove(QHoverEvent *event)
     bool handled = false;
     const QPointF &position = event->position();
 
+    const QPointF hitPosition = position.toPoint();
     bool hovering = false;
-    for (auto &rectNodesInputRects : m_rectNodesInputRects) {
-        for (auto &barSelection : rectNodesInputRects) {
-            int indexInSet = 0;
-
-            for (auto &rect : barSelection.rects) {
-                if (rect.contains(event->position().toPoint())) {
-                    const QString &name = barSelection.series->name();
-                    const QPointF point(indexInSet, barSelection.barSet->at(indexInSet));
-
-                    if (!m_currentHoverSeries) {
-                        m_currentHoverSeries = barSelection.series;
-                        emit barSelection.series->hoverEnter(name, position, point);
-                    }
-
-                    emit barSelection.series->hover(name, position, point);
-                    hovering = true;
-                    handled = true;
+    for (auto it = m_rectNodesInputRects.cbegin(); it != m_rectNodesInputRects.cend(); ++it) {
+        qsizetype indexInSet = 0;
+        qsizetype first = 0;
+        qsizetype end = 0;
+        if (!barCandidates(it.key(), hitPosition, &indexInSet, &first, &end))
+            continue;
+        for (qsizetype i = first; i < end; ++i) {
+            const auto &barSelection = it.value().at(i);
+            if (indexInSet < barSelection.rects.size()
+                && barSelection.rects.at(indexInSet).contains(hitPosition)) {
+                const QString &name = barSelection.series->name();
+                const QPointF point(indexInSet, barSelection.barSet->at(indexInSet));
+
+                if (!m_currentHoverSeries) {
+                    m_currentHoverSeries = barSelection.series;
+                    emit barSelection.series->hoverEnter(name, position, point);
                 }
-                indexInSet++;
+
+                emit barSelection.series->hover(name, position, point);
+                hovering = true;
+                handled = true;
             }
         }
     }
@@ -16,9 +16,12 @@
 
 #include <QQuickItem>
 #include <QtQuick/private/qquicktext_p.h>
+#include <private/coloredgeometry_p.h>
+#include <private/labelbatch_p.h>
 #include <QtCore/QHash>
 #include <QtCore/QList>
 #include <QtCore/QRectF>
+#include <QtCore/QSet>
 #include <QtGui/QColor>
 
 QT_BEGIN_NAMESPACE
@@ -42,6 +45,9 @@ public:
     bool handleMousePress(QMouseEvent *event);
     bool handleHoverMove(QHoverEvent *event);
 
+protected:
+    QSGNode *updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *updatePaintNodeData) override;
+
 Q_SIGNALS:
 
 private:
@@ -50,6 +56,23 @@ private:
         QBarSet *barSet = nullptr;
         QList<QRectF> rects;
     };
+    // Category grid of the bars, used to find the bars under a position without
+    // testing every rect
+    struct BarLayout {
+        bool vertical = true;
+        bool stacked = false;
+        float categorySize = 0;
+        float barCentering = 0;
+        float barStride = 0;
+    };
+    struct CategoryTotals {
+        QList<QBarSet *> barSets;
+        QList<QMetaObject::Connection> connections;
+        QList<float> totals;
+        // Categories from dirtyFrom on, and the dirtyCategories before it, need summing
+        qsizetype dirtyFrom = 0;
+        QList<qsizetype> dirtyCategories;
+    };
     struct BarSeriesData {
         QRectF rect;
         QColor color;
@@ -68,15 +91,30 @@ private:
     QColor getSetBorderColor(QBarSeries *series, QBarSet *set, qsizetype barSerieIndex);
     qreal getSetBorderWidth(QBarSeries *series, QBarSet *set);
     QString generateLabelText(QBarSeries *series, qreal value);
+    QRectF valueLabelRect(QBarSeries *series, QSizeF textSize, const BarSeriesData &d);
+    QColor valueLabelColor(const BarSeriesData &d) const;
     void positionLabelItem(QBarSeries *series, QQuickText *textItem, const BarSeriesData &d);
     void updateComponents(QBarSeries *series);
+    void updateBarNode(QSGNode *root, QBarSeries *series);
     void updateValueLabels(QBarSeries *series);
+    const QList<float> &categoryTotals(QBarSeries *series, qsizetype valuesPerSet);
+    bool barCandidates(QBarSeries *series, QPointF position, qsizetype *category,
+                       qsizetype *firstSelection, qsizetype *endSelection) const;
 
     QGraphsView *m_graph = nullptr;
     QHash<QBarSeries *, QList<BarSelectionRect>> m_rectNodesInputRects;
+    QHash<QBarSeries *, BarLayout> m_barLayouts;
+    QHash<QBarSeries *, CategoryTotals> m_categoryTotals;
     QHash<QBarSeries *, QList<QQuickItem *>> m_barItems;
     QHash<QBarSeries *, QList<QQuickText *>> m_labelTextItems;
     QHash<QBarSeries *, QList<BarSeriesData>> m_seriesData;
+    // Bars without a barDelegate are drawn from a single geometry node per series
+    ColoredGeometryNodes m_barNodes{ ColoredGeometryNodes::Indices::UnsignedInt };
+    QSet<QBarSeries *> m_dirtyBarNodes;
+    // Value labels without rotation are drawn from one label batch per series
+    QHash<QBarSeries *, LabelBatch *> m_labelBatches;
+    QHash<QBarSeries *, QSGNode *> m_labelNodes;
+    QList<QSGNode *> m_removedLabelNodes;
 
     QBarSeries *m_currentHoverSeries = nullptr;
     qsizetype m_colorIndex = -1;
@@ -0,0 +1,365 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <private/coloredgeometry_p.h>
+#include <QtCore/QVarLengthArray>
+#include <QtCore/qmath.h>
+#include <QtQuick/QQuickWindow>
+#include <QtQuick/QSGGeometryNode>
+#include <QtQuick/QSGVertexColorMaterial>
+
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+static void removeAndDeleteNode(QSGGeometryNode *node)
+{
+    if (auto parent = node->parent())
+        parent->removeChildNode(node);
+    delete node;
+}
+
+void ColoredGeometryNodes::sync(bool recreated)
+{
+    if (recreated) {
+        m_nodes.clear();
+    } else {
+        for (auto node : std::as_const(m_removedNodes))
+            removeAndDeleteNode(node);
+    }
+    m_removedNodes.clear();
+}
+
+QSGGeometryNode *ColoredGeometryNodes::createNode(Indices indices)
+{
+    auto node = new QSGGeometryNode();
+    const auto &attributes = QSGGeometry::defaultAttributes_ColoredPoint2D();
+    auto geometry = indices == Indices::UnsignedInt
+                            ? new QSGGeometry(attributes, 0, 0, QSGGeometry::UnsignedIntType)
+                            : new QSGGeometry(attributes, 0);
+    geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+    node->setGeometry(geometry);
+    node->setFlag(QSGNode::OwnsGeometry);
+    node->setMaterial(new QSGVertexColorMaterial());
+    node->setFlag(QSGNode::OwnsMaterial);
+    return node;
+}
+
+QSGGeometryNode *ColoredGeometryNodes::node(QSGNode *parent, const QAbstractSeries *series)
+{
+    auto &node = m_nodes[series];
+    if (!node) {
+        node = createNode(m_indices);
+        parent->appendChildNode(node);
+    }
+    return node;
+}
+
+void ColoredGeometryNodes::deleteNode(const QAbstractSeries *series)
+{
+    if (auto node = m_nodes.take(series))
+        removeAndDeleteNode(node);
+}
+
+bool ColoredGeometryNodes::release(const QAbstractSeries *series)
+{
+    auto node = m_nodes.take(series);
+    if (node)
+        m_removedNodes << node;
+    return node != nullptr;
+}
+
+qreal featherWidth(const QQuickItem *item)
+{
+    return 1.0 / (item->window() ? item->window()->effectiveDevicePixelRatio() : 1.0);
+}
+
+// Miters of joins and of antialiased polygon edges are limited to this multiple of the offset
+// of the edges
+static constexpr qreal maxMiterLength = 4.0;
+
+// Pairs the points of the upper and lower edge of an area into columns of the same x, upper
+// and lower point interleaved. Each edge gets a point at every x of the other one, interpolated
+// along its segments, and the ends of the edges are joined like in the outline of the area.
+// Returns false when either edge is not sorted by x, as the area can't be split into columns.
+bool areaColumns(QSpan<const QPointF> upper, QSpan<const QPointF> lower, QList<QPointF> &columns)
+{
+    columns.clear();
+    auto lessX = [](QPointF a, QPointF b) { return a.x() < b.x(); };
+    if (upper.isEmpty() || lower.isEmpty() || !std::is_sorted(upper.begin(), upper.end(), lessX)
+        || !std::is_sorted(lower.begin(), lower.end(), lessX)) {
+        return false;
+    }
+
+    // Points of an edge, after the end of the other edge which reaches further out, if any
+    struct Edge
+    {
+        QSpan<const QPointF> points;
+        const QPointF *head = nullptr;
+        const QPointF *tail = nullptr;
+
+        qsizetype size() const { return points.size() + (head ? 1 : 0) + (tail ? 1 : 0); }
+        QPointF at(qsizetype index) const
+        {
+            if (head) {
+                if (index == 0)
+                    return *head;
+                --index;
+            }
+            return index < points.size() ? points[index] : *tail;
+        }
+        // Point of the edge at x, which is at most the x of the point at next
+        QPointF pointAt(qsizetype next, qreal x) const
+        {
+            if (next == 0)
+                return at(0);
+            if (next >= size())
+                return at(size() - 1);
+            const QPointF from = at(next - 1);
+            const QPointF to = at(next);
+            if (to.x() <= from.x())
+                return from;
+            const qreal t = (x - from.x()) / (to.x() - from.x());
+            return QPointF(x, from.y() + t * (to.y() - from.y()));
+        }
+    };
+
+    Edge upperEdge{ upper };
+    Edge lowerEdge{ lower };
+    if (upper.front().x() < lower.front().x())
+        lowerEdge.head = &upper.front();
+    else if (lower.front().x() < upper.front().x())
+        upperEdge.head = &lower.front();
+    if (upper.back().x() > lower.back().x())
+        lowerEdge.tail = &upper.back();
+    else if (lower.back().x() > upper.back().x())
+        upperEdge.tail = &lower.back();
+
+    const qsizetype upperCount = upperEdge.size();
+    const qsizetype lowerCount = lowerEdge.size();
+    columns.reserve(2 * (upperCount + lowerCount));
+    qsizetype i = 0;
+    qsizetype j = 0;
+    while (i < upperCount || j < lowerCount) {
+        const bool upperNext = j == lowerCount
+                               || (i < upperCount && upperEdge.at(i).x() <= lowerEdge.at(j).x());
+        const bool lowerNext = i == upperCount
+                               || (j < lowerCount && lowerEdge.at(j).x() <= upperEdge.at(i).x());
+        columns.append(upperNext ? upperEdge.at(i) : upperEdge.pointAt(i, lowerEdge.at(j).x()));
+        columns.append(lowerNext ? lowerEdge.at(j) : lowerEdge.pointAt(j, upperEdge.at(i).x()));
+        if (upperNext)
+            ++i;
+        if (lowerNext)
+            ++j;
+    }
+    return true;
+}
+
+// Outward miters of the vertices of the closed polygon. Moving each vertex by a distance times
+// its miter moves the edges next to it outwards by that distance. Equal consecutive vertices
+// share the miter of the edge before them.
+void polygonMiters(QSpan<const QPointF> polygon, QList<QPointF> &miters)
+{
+    const qsizetype count = polygon.size();
+    miters.assign(count, QPointF());
+
+    // Left normals of the edges from each vertex to the next one
+    QVarLengthArray<QPointF, 256> normals(count);
+    qreal area = 0;
+    qsizetype validEdge = -1;
+    for (qsizetype i = 0; i < count; ++i) {
+        const QPointF &from = polygon[i];
+        const QPointF &to = polygon[(i + 1) % count];
+        area += from.x() * to.y() - to.x() * from.y();
+        const QPointF delta = to - from;
+        const qreal length = qHypot(delta.x(), delta.y());
+        normals[i] = length > 0 ? QPointF(-delta.y(), delta.x()) / length : QPointF();
+        if (length > 0)
+            validEdge = i;
+    }
+    if (validEdge < 0)
+        return;
+    for (qsizetype k = 1; k < count; ++k) {
+        const qsizetype i = (validEdge + k) % count;
+        if (normals[i].isNull())
+            normals[i] = normals[(i + count - 1) % count];
+    }
+
+    // Left normals point inwards in polygons of positive area
+    const qreal outwards = area > 0 ? -1.0 : 1.0;
+    for (qsizetype i = 0; i < count; ++i) {
+        const QPointF n1 = normals[(i + count - 1) % count];
+        const QPointF n2 = normals[i];
+        const QPointF sum = n1 + n2;
+        const qreal sumLength = qHypot(sum.x(), sum.y());
+        if (qFuzzyIsNull(sumLength)) {
+            // The polygon turns back, so the vertex is the tip of a spike
+            miters[i] = QPointF(n1.y(), -n1.x()) * maxMiterLength;
+            continue;
+        }
+        // The length of the miter is 1 / cos of half of the angle between the normals
+        const qreal dot = QPointF::dotProduct(n1, n2);
+        const QPointF miter = 2.0 / (1.0 + dot) > maxMiterLength * maxMiterLength
+                    ? sum * (maxMiterLength / sumLength)
+                    : sum / (1.0 + dot);
+        miters[i] = miter * outwards;
+    }
+}
+
+// Appends the triangles of a ring around the closed polygon. The ring fades out from the
+// polygon moved inwards by half of the feather width to the polygon moved outwards by it,
+// so that a fill drawn up to the inner polygon gets antialiased edges. miters are the ones
+// from polygonMiters.
+void featherPolygon(QSpan<const QPointF> polygon,
+                    QSpan<const QPointF> miters,
+                    qreal feather,
+                    QRgb color,
+                    ColoredVertices &vertices)
+{
+    const qreal halfFeather = feather * 0.5;
+    vertices.reserve(vertices.size() + 6 * polygon.size());
+    for (qsizetype i = 0; i < polygon.size(); ++i) {
+        const qsizetype next = (i + 1) % polygon.size();
+        const QPointF inner1 = polygon[i] - miters[i] * halfFeather;
+        const QPointF outer1 = polygon[i] + miters[i] * halfFeather;
+        const QPointF inner2 = polygon[next] - miters[next] * halfFeather;
+        const QPointF outer2 = polygon[next] + miters[next] * halfFeather;
+        appendColoredVertex(vertices, inner1, color, 1.0);
+        appendColoredVertex(vertices, outer1, color, 0.0);
+        appendColoredVertex(vertices, inner2, color, 1.0);
+        appendColoredVertex(vertices, inner2, color, 1.0);
+        appendColoredVertex(vertices, outer1, color, 0.0);
+        appendColoredVertex(vertices, outer2, color, 0.0);
+    }
+}
+
+// Appends the quads across a stroke segment from from to to, from its left edge to its right
+// one. The edges are at offsets times fromOffset and toOffset from the ends of the segment.
+static void appendStrokeQuads(QPointF from,
+                              QPointF fromOffset,
+                              QPointF to,
+                              QPointF toOffset,
+                              const qreal (&offsets)[4],
+                              const qreal (&coverages)[4],
+                              QRgb color,
+                              ColoredVertices &vertices)
+{
+    for (int k = 0; k < 3; ++k) {
+        const QPointF a = from + fromOffset * offsets[k];
+        const QPointF b = from + fromOffset * offsets[k + 1];
+        const QPointF c = to + toOffset * offsets[k];
+        const QPointF d = to + toOffset * offsets[k + 1];
+        appendColoredVertex(vertices, a, color, coverages[k]);
+        appendColoredVertex(vertices, b, color, coverages[k + 1]);
+        appendColoredVertex(vertices, c, color, coverages[k]);
+        appendColoredVertex(vertices, c, color, coverages[k]);
+        appendColoredVertex(vertices, b, color, coverages[k + 1]);
+        appendColoredVertex(vertices, d, color, coverages[k + 1]);
+    }
+}
+
+// Appends the triangles of a stroke of the given width along the closed polygon. Both sides
+// of the stroke fade out over the feather width for antialiasing. Segments meet at miter
+// joins, so that a translucent stroke is blended once. Joins sharper than maxMiterLength
+// are beveled.
+void strokePolygon(QSpan<const QPointF> polygon,
+                   qreal width,
+                   qreal feather,
+                   QRgb color,
+                   ColoredVertices &vertices)
+{
+    QVarLengthArray<QPointF, 256> points;
+    for (const QPointF &point : polygon) {
+        if (points.isEmpty() || points.last() != point)
+            points.append(point);
+    }
+    while (points.size() > 1 && points.first() == points.last())
+        points.removeLast();
+    const qsizetype count = points.size();
+    if (count < 2 || width <= 0)
+        return;
+
+    // Left normals of the segments from each point to the next one
+    QVarLengthArray<QPointF, 256> normals(count);
+    for (qsizetype i = 0; i < count; ++i) {
+        const QPointF delta = points[(i + 1) % count] - points[i];
+        normals[i] = QPointF(-delta.y(), delta.x()) / qHypot(delta.x(), delta.y());
+    }
+
+    // Offsets across the stroke from the left edge to the right one. Strokes thinner than
+    // the feather width are drawn with partial coverage.
+    const qreal halfWidth = width * 0.5;
+    const qreal solid = qMax(0.0, halfWidth - feather * 0.5);
+    const qreal edge = halfWidth + feather * 0.5;
+    const qreal coverage = qMin(1.0, width / feather);
+    const qreal offsets[4] = { edge, solid, -solid, -edge };
+    const qreal coverages[4] = { 0.0, coverage, coverage, 0.0 };
+
+    // Miters of the joins, or null for bevels
+    QVarLengthArray<QPointF, 256> miters(count);
+    for (qsizetype i = 0; i < count; ++i) {
+        const QPointF n1 = normals[(i + count - 1) % count];
+        const QPointF n2 = normals[i];
+        const qreal dot = QPointF::dotProduct(n1, n2);
+        miters[i] = 2.0 / qMax(1.0 + dot, 1e-9) > maxMiterLength * maxMiterLength
+                        ? QPointF()
+                        : (n1 + n2) / (1.0 + dot);
+    }
+
+    auto addVertex = [&vertices, color](QPointF point, qreal vertexCoverage) {
+        appendColoredVertex(vertices, point, color, vertexCoverage);
+    };
+
+    vertices.reserve(vertices.size() + 27 * count);
+    for (qsizetype i = 0; i < count; ++i) {
+        const qsizetype next = (i + 1) % count;
+        const QPointF fromOffset = miters[i].isNull() ? normals[i] : miters[i];
+        const QPointF toOffset = miters[next].isNull() ? normals[i] : miters[next];
+        appendStrokeQuads(points[i], fromOffset, points[next], toOffset, offsets, coverages, color,
+                          vertices);
+
+        if (!miters[next].isNull())
+            continue;
+        // Bevel on the outer side of the turn, which is on the right of a left turn
+        const QPointF n1 = normals[i];
+        const QPointF n2 = normals[next];
+        const qreal side = n1.x() * n2.y() - n1.y() * n2.x() > 0 ? -1.0 : 1.0;
+        const QPointF &point = points[next];
+        addVertex(point, coverage);
+        addVertex(point + n1 * (side * solid), coverage);
+        addVertex(point + n2 * (side * solid), coverage);
+        addVertex(point + n1 * (side * solid), coverage);
+        addVertex(point + n1 * (side * edge), 0.0);
+        addVertex(point + n2 * (side * solid), coverage);
+        addVertex(point + n2 * (side * solid), coverage);
+        addVertex(point + n1 * (side * edge), 0.0);
+        addVertex(point + n2 * (side * edge), 0.0);
+    }
+}
+
+// Appends the triangles of a straight stroke of the given width from from to to, with butt
+// ends. Both sides of the stroke fade out over the feather width like in strokePolygon.
+void strokeLine(QPointF from,
+                QPointF to,
+                qreal width,
+                qreal feather,
+                QRgb color,
+                ColoredVertices &vertices)
+{
+    const QPointF delta = to - from;
+    const qreal length = qHypot(delta.x(), delta.y());
+    if (length <= 0 || width <= 0)
+        return;
+
+    const QPointF normal = QPointF(-delta.y(), delta.x()) / length;
+    const qreal halfWidth = width * 0.5;
+    const qreal solid = qMax(0.0, halfWidth - feather * 0.5);
+    const qreal edge = halfWidth + feather * 0.5;
+    const qreal coverage = qMin(1.0, width / feather);
+    const qreal offsets[4] = { edge, solid, -solid, -edge };
+    const qreal coverages[4] = { 0.0, coverage, coverage, 0.0 };
+    vertices.reserve(vertices.size() + 18);
+    appendStrokeQuads(from, normal, to, normal, offsets, coverages, color, vertices);
+}
+
+QT_END_NAMESPACE
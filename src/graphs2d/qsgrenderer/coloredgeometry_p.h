@@ -0,0 +1,113 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#ifndef COLOREDGEOMETRY_H
+#define COLOREDGEOMETRY_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the QtGraphs API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QPointF>
+#include <QtCore/qspan.h>
+#include <QtGraphs/qgraphsglobal.h>
+#include <QtGui/qrgb.h>
+#include <QtQuick/QSGGeometry>
+
+QT_BEGIN_NAMESPACE
+
+class QAbstractSeries;
+class QQuickItem;
+class QSGGeometryNode;
+class QSGNode;
+
+// Triangles drawn with QSGVertexColorMaterial. Colors are premultiplied, as expected by the
+// material, and scaled by the coverage of the vertex for antialiasing.
+using ColoredVertices = QList<QSGGeometry::ColoredPoint2D>;
+
+inline void setColoredVertex(QSGGeometry::ColoredPoint2D *vertex,
+                             QPointF point,
+                             QRgb color,
+                             qreal coverage = 1.0)
+{
+    vertex->set(point.x(),
+                point.y(),
+                uchar(qRound(qRed(color) * coverage)),
+                uchar(qRound(qGreen(color) * coverage)),
+                uchar(qRound(qBlue(color) * coverage)),
+                uchar(qRound(qAlpha(color) * coverage)));
+}
+
+inline void appendColoredVertex(ColoredVertices &vertices,
+                                QPointF point,
+                                QRgb color,
+                                qreal coverage = 1.0)
+{
+    vertices.append(QSGGeometry::ColoredPoint2D());
+    setColoredVertex(&vertices.last(), point, color, coverage);
+}
+
+// Geometry nodes of the series of a renderer, drawing triangles with QSGVertexColorMaterial.
+// Nodes of series removed during polish are deleted on the next updatePaintNode.
+class ColoredGeometryNodes
+{
+public:
+    enum class Indices { None, UnsignedInt };
+
+    explicit ColoredGeometryNodes(Indices indices = Indices::None)
+        : m_indices(indices)
+    {}
+
+    // Called at the start of updatePaintNode. When the scene graph was (re)initialized, the
+    // earlier nodes are gone with their parent, so they are forgotten. Otherwise the nodes of
+    // removed series are deleted.
+    void sync(bool recreated);
+    // New node with an empty geometry, not owned by any ColoredGeometryNodes
+    static QSGGeometryNode *createNode(Indices indices = Indices::None);
+    // Node of series, created and appended to parent when it has none
+    QSGGeometryNode *node(QSGNode *parent, const QAbstractSeries *series);
+    void deleteNode(const QAbstractSeries *series);
+    // Schedules the node of series to be deleted on the next sync, returns whether it had one
+    bool release(const QAbstractSeries *series);
+
+private:
+    QHash<const QAbstractSeries *, QSGGeometryNode *> m_nodes;
+    QList<QSGGeometryNode *> m_removedNodes;
+    Indices m_indices = Indices::None;
+};
+
+// Width over which edges are antialiased, one device pixel of the window of item
+qreal featherWidth(const QQuickItem *item);
+
+Q_GRAPHS_EXPORT bool areaColumns(QSpan<const QPointF> upper,
+                                 QSpan<const QPointF> lower,
+                                 QList<QPointF> &columns);
+Q_GRAPHS_EXPORT void polygonMiters(QSpan<const QPointF> polygon, QList<QPointF> &miters);
+Q_GRAPHS_EXPORT void featherPolygon(QSpan<const QPointF> polygon,
+                                    QSpan<const QPointF> miters,
+                                    qreal feather,
+                                    QRgb color,
+                                    ColoredVertices &vertices);
+Q_GRAPHS_EXPORT void strokePolygon(QSpan<const QPointF> polygon,
+                                   qreal width,
+                                   qreal feather,
+                                   QRgb color,
+                                   ColoredVertices &vertices);
+Q_GRAPHS_EXPORT void strokeLine(QPointF from,
+                                QPointF to,
+                                qreal width,
+                                qreal feather,
+                                QRgb color,
+                                ColoredVertices &vertices);
+
+QT_END_NAMESPACE
+
+#endif // COLOREDGEOMETRY_H
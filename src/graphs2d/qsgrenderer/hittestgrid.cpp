@@ -0,0 +1,130 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <private/hittestgrid_p.h>
+#include <QtCore/qmath.h>
+
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+// Upper limit for the number of cells in either direction
+static constexpr int maxGridDimension = 256;
+static constexpr qreal minCellSize = 8.0;
+
+// Updates the grid for rects. Rectangles before from are expected to be unchanged.
+// Only the rectangles that moved to different cells are moved, so updating after a
+// few points changed is cheap. The grid is rebuilt when the area size changes.
+void HitTestGrid::update(const QList<QRectF> &rects, QSizeF area, qsizetype from)
+{
+    if (rects.isEmpty()) {
+        clear();
+        return;
+    }
+
+    if (m_cells.isEmpty() || area != m_area) {
+        rebuild(rects, area);
+        return;
+    }
+
+    for (qsizetype i = rects.size(); i < m_ranges.size(); ++i)
+        remove(i, m_ranges.at(i));
+    m_ranges.resize(rects.size());
+
+    for (qsizetype i = qMin(from, rects.size()); i < rects.size(); ++i) {
+        const QRect range = cellRange(rects.at(i));
+        if (range == m_ranges.at(i))
+            continue;
+        remove(i, m_ranges.at(i));
+        insert(i, range);
+        m_ranges[i] = range;
+    }
+}
+
+void HitTestGrid::clear()
+{
+    m_area = QSizeF();
+    m_cellSize = 0;
+    m_columns = 0;
+    m_rows = 0;
+    m_cells.clear();
+    m_ranges.clear();
+}
+
+HitTestGrid::Indexes HitTestGrid::indexesAt(const QList<QRectF> &rects, QPointF position) const
+{
+    Indexes result;
+    if (m_cells.isEmpty())
+        return result;
+
+    const int column = qBound(0, int(qFloor(position.x() / m_cellSize)), m_columns - 1);
+    const int row = qBound(0, int(qFloor(position.y() / m_cellSize)), m_rows - 1);
+    for (qsizetype index : m_cells.at(row * m_columns + column)) {
+        if (index < rects.size() && rects.at(index).contains(position))
+            result.append(index);
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+void HitTestGrid::rebuild(const QList<QRectF> &rects, QSizeF area)
+{
+    // Cells about the size of the largest rectangle keep most of them in one cell
+    qreal largest = 0;
+    for (const QRectF &rect : rects) {
+        if (qIsFinite(rect.width()) && qIsFinite(rect.height()))
+            largest = qMax(largest, qMax(rect.width(), rect.height()));
+    }
+
+    m_area = area;
+    m_cellSize = qMax(minCellSize,
+                      qMax(largest, qMax(area.width(), area.height()) / maxGridDimension));
+    m_columns = qMax(1, qCeil(area.width() / m_cellSize));
+    m_rows = qMax(1, qCeil(area.height() / m_cellSize));
+
+    m_cells.clear();
+    m_cells.resize(m_columns * m_rows);
+    m_ranges.resize(rects.size());
+    for (qsizetype i = 0; i < rects.size(); ++i) {
+        m_ranges[i] = cellRange(rects.at(i));
+        insert(i, m_ranges.at(i));
+    }
+}
+
+QRect HitTestGrid::cellRange(const QRectF &rect) const
+{
+    if (!qIsFinite(rect.left()) || !qIsFinite(rect.top()) || !qIsFinite(rect.right())
+        || !qIsFinite(rect.bottom()) || rect.isEmpty()) {
+        return QRect();
+    }
+
+    const int left = qBound(0, int(qFloor(rect.left() / m_cellSize)), m_columns - 1);
+    const int right = qBound(0, int(qFloor(rect.right() / m_cellSize)), m_columns - 1);
+    const int top = qBound(0, int(qFloor(rect.top() / m_cellSize)), m_rows - 1);
+    const int bottom = qBound(0, int(qFloor(rect.bottom() / m_cellSize)), m_rows - 1);
+    return QRect(QPoint(left, top), QPoint(right, bottom));
+}
+
+void HitTestGrid::insert(qsizetype index, const QRect &range)
+{
+    if (!range.isValid())
+        return;
+
+    for (int row = range.top(); row <= range.bottom(); ++row) {
+        for (int column = range.left(); column <= range.right(); ++column)
+            m_cells[row * m_columns + column].append(index);
+    }
+}
+
+void HitTestGrid::remove(qsizetype index, const QRect &range)
+{
+    if (!range.isValid())
+        return;
+
+    for (int row = range.top(); row <= range.bottom(); ++row) {
+        for (int column = range.left(); column <= range.right(); ++column)
+            m_cells[row * m_columns + column].removeOne(index);
+    }
+}
+
+QT_END_NAMESPACE
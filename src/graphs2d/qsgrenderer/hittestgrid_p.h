@@ -0,0 +1,55 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#ifndef HITTESTGRID_H
+#define HITTESTGRID_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the QtGraphs API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+
+#include <QtCore/QList>
+#include <QtCore/QRect>
+#include <QtCore/QRectF>
+#include <QtCore/QVarLengthArray>
+
+QT_BEGIN_NAMESPACE
+
+// Uniform grid over the plot area for finding the rectangles that contain a position.
+// Each rectangle is stored in every cell it overlaps, so a lookup only needs to test
+// the rectangles of one cell. Rectangles outside of the area are kept in the edge cells.
+class HitTestGrid
+{
+public:
+    using Indexes = QVarLengthArray<qsizetype, 8>;
+
+    void update(const QList<QRectF> &rects, QSizeF area, qsizetype from = 0);
+    void clear();
+
+    // Indexes of the rectangles containing position, in ascending order
+    Indexes indexesAt(const QList<QRectF> &rects, QPointF position) const;
+
+private:
+    void rebuild(const QList<QRectF> &rects, QSizeF area);
+    QRect cellRange(const QRectF &rect) const;
+    void insert(qsizetype index, const QRect &range);
+    void remove(qsizetype index, const QRect &range);
+
+    QSizeF m_area;
+    qreal m_cellSize = 0;
+    int m_columns = 0;
+    int m_rows = 0;
+    QList<QList<qsizetype>> m_cells;
+    // Cells each rectangle is stored in, an invalid QRect when it is not stored
+    QList<QRect> m_ranges;
+};
+
+QT_END_NAMESPACE
+
+#endif // HITTESTGRID_H
@@ -0,0 +1,155 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <private/labelbatch_p.h>
+#include <QtCore/QSet>
+#include <QtCore/QVarLengthArray>
+#include <QtGui/QTextLayout>
+#include <QtQuick/QQuickWindow>
+#include <QtQuick/QSGTextNode>
+
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+// Layouts of texts which are not shown anymore are kept up to this count, so that
+// labels which come back while panning don't need to be laid out again
+static constexpr qsizetype maxCachedLayouts = 512;
+
+LabelBatch::~LabelBatch()
+{
+    qDeleteAll(m_layouts);
+}
+
+void LabelBatch::setFont(const QFont &font)
+{
+    if (m_font == font)
+        return;
+    m_font = font;
+    qDeleteAll(m_layouts);
+    m_layouts.clear();
+    // Positions of the current labels depend on the font, so they are added again
+    m_labels.clear();
+    m_dirty = true;
+}
+
+QSizeF LabelBatch::textSize(const QString &text)
+{
+    const QTextLine line = layout(text)->lineAt(0);
+    return QSizeF(line.naturalTextWidth(), line.height());
+}
+
+void LabelBatch::begin()
+{
+    m_newLabels.clear();
+}
+
+// Adds a label with text aligned inside of rect, like in a Text item of the same geometry
+void LabelBatch::addLabel(const QString &text, const QRectF &rect, Qt::Alignment alignment,
+                          const QColor &color)
+{
+    if (text.isEmpty())
+        return;
+
+    const QSizeF size = textSize(text);
+    QPointF position = rect.topLeft();
+    if (alignment & Qt::AlignRight)
+        position.rx() += rect.width() - size.width();
+    else if (alignment & Qt::AlignHCenter)
+        position.rx() += 0.5 * (rect.width() - size.width());
+    if (alignment & Qt::AlignBottom)
+        position.ry() += rect.height() - size.height();
+    else if (alignment & Qt::AlignVCenter)
+        position.ry() += 0.5 * (rect.height() - size.height());
+
+    m_newLabels.append({ text, position, color });
+}
+
+void LabelBatch::end()
+{
+    if (m_newLabels != m_labels) {
+        m_labels.swap(m_newLabels);
+        m_dirty = true;
+    }
+    m_newLabels.clear();
+    releaseUnusedLayouts();
+}
+
+void LabelBatch::clear()
+{
+    begin();
+    end();
+}
+
+void LabelBatch::updateNode(QSGNode *node, QQuickWindow *window, bool force)
+{
+    if (!m_dirty && !force)
+        return;
+    m_dirty = false;
+
+    QVarLengthArray<QColor, 4> colors;
+    for (const auto &label : std::as_const(m_labels)) {
+        if (!colors.contains(label.color))
+            colors.append(label.color);
+    }
+
+    while (node->childCount() > colors.size()) {
+        QSGNode *child = node->lastChild();
+        node->removeChildNode(child);
+        delete child;
+    }
+    while (node->childCount() < colors.size())
+        node->appendChildNode(window->createTextNode());
+
+    QSGNode *child = node->firstChild();
+    for (const auto &color : std::as_const(colors)) {
+        auto textNode = static_cast<QSGTextNode *>(child);
+        textNode->clear();
+        textNode->setColor(color);
+        for (const auto &label : std::as_const(m_labels)) {
+            if (label.color == color)
+                textNode->addTextLayout(label.position, layout(label.text));
+        }
+        child = child->nextSibling();
+    }
+}
+
+QTextLayout *LabelBatch::layout(const QString &text)
+{
+    auto it = m_layouts.constFind(text);
+    if (it != m_layouts.cend())
+        return *it;
+
+    auto layout = new QTextLayout(text, m_font);
+    QTextOption option;
+    option.setWrapMode(QTextOption::NoWrap);
+    layout->setTextOption(option);
+    layout->setCacheEnabled(true);
+    layout->beginLayout();
+    QTextLine line = layout->createLine();
+    line.setLineWidth(std::numeric_limits<float>::max());
+    line.setPosition(QPointF(0, 0));
+    layout->endLayout();
+    m_layouts.insert(text, layout);
+    return layout;
+}
+
+void LabelBatch::releaseUnusedLayouts()
+{
+    if (m_layouts.size() <= maxCachedLayouts)
+        return;
+
+    QSet<QString> usedTexts;
+    for (const auto &label : std::as_const(m_labels))
+        usedTexts.insert(label.text);
+    for (auto it = m_layouts.begin(); it != m_layouts.end();) {
+        if (usedTexts.contains(it.key())) {
+            ++it;
+        } else {
+            delete *it;
+            it = m_layouts.erase(it);
+        }
+    }
+}
+
+QT_END_NAMESPACE
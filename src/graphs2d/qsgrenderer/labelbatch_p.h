@@ -0,0 +1,83 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#ifndef LABELBATCH_H
+#define LABELBATCH_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the QtGraphs API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QPointF>
+#include <QtCore/QRectF>
+#include <QtCore/QSizeF>
+#include <QtGui/QColor>
+#include <QtGui/QFont>
+
+QT_BEGIN_NAMESPACE
+
+class QQuickWindow;
+class QSGNode;
+class QTextLayout;
+
+// Default text labels of an axis or a series, drawn without a QQuickText item per label.
+// The text of each label is laid out once and kept while it is shown, and all labels are
+// added to the text nodes under one node, one text node per label color. Their glyphs come
+// from the shared glyph atlas of the window.
+class LabelBatch
+{
+public:
+    LabelBatch() = default;
+    ~LabelBatch();
+
+    void setFont(const QFont &font);
+    // Size of text laid out in the font of the batch
+    QSizeF textSize(const QString &text);
+
+    // Labels are collected between begin() and end(), replacing the earlier labels
+    void begin();
+    void addLabel(const QString &text, const QRectF &rect, Qt::Alignment alignment,
+                  const QColor &color);
+    void end();
+    void clear();
+
+    bool isDirty() const { return m_dirty; }
+    // Rebuilds the text nodes under node, when the labels changed or force is set
+    void updateNode(QSGNode *node, QQuickWindow *window, bool force = false);
+
+private:
+    struct Label
+    {
+        QString text;
+        QPointF position;
+        QColor color;
+
+        bool operator==(const Label &other) const
+        {
+            return text == other.text && position == other.position && color == other.color;
+        }
+    };
+
+    QTextLayout *layout(const QString &text);
+    void releaseUnusedLayouts();
+
+    QFont m_font;
+    QHash<QString, QTextLayout *> m_layouts;
+    QList<Label> m_labels;
+    QList<Label> m_newLabels;
+    bool m_dirty = false;
+
+    Q_DISABLE_COPY_MOVE(LabelBatch)
+};
+
+QT_END_NAMESPACE
+
+#endif // LABELBATCH_H
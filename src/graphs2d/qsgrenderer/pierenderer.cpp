@@ -9,8 +9,18 @@
 #include <private/qgraphsview_p.h>
 #include <private/qpieseries_p.h>
 #include <private/qpieslice_p.h>
+#include <private/coloredgeometry_p.h>
 #include <private/qquickshape_p.h>
 #include <private/qquicksvgparser_p.h>
+#include <QtCore/QVarLengthArray>
+#include <QtGui/qrgb.h>
+#include <QtQuick/QSGGeometryNode>
+
+#include <algorithm>
+
+// Slice arcs are split into segments of about this many pixels
+static constexpr qreal arcSegmentLength = 4.0;
+static constexpr int maxArcSegments = 360;
 
 PieRenderer::PieRenderer(QGraphsView *graph)
     : QQuickItem(graph)
@@ -19,10 +29,19 @@ PieRenderer::PieRenderer(QGraphsView *graph)
 {
     setFlag(QQuickItem::ItemHasContents);
     setClip(true);
+}
 
-    m_shape = new QQuickShape(this);
-    m_shape->setParentItem(this);
-    m_shape->setPreferredRendererType(QQuickShape::CurveRenderer);
+bool PieRenderer::SliceGeometry::operator==(const SliceGeometry &other) const
+{
+    return center == other.center && qFuzzyCompare(radius, other.radius)
+           && qFuzzyCompare(holeSize, other.holeSize)
+           && qFuzzyCompare(startAngle, other.startAngle)
+           && qFuzzyCompare(angleSpan, other.angleSpan)
+           && qFuzzyCompare(explodeDistance + 1.0, other.explodeDistance + 1.0)
+           && qFuzzyCompare(borderWidth, other.borderWidth) && color == other.color
+           && borderColor == other.borderColor
+           && qFuzzyCompare(labelArmLengthFactor, other.labelArmLengthFactor)
+           && labelSize == other.labelSize && labelPosition == other.labelPosition;
 }
 
 PieRenderer::~PieRenderer() {}
@@ -34,35 +53,44 @@ void PieRenderer::setSize(QSizeF size)
 
 void PieRenderer::handlePolish(QPieSeries *series)
 {
-    for (QPieSlice *slice : series->slices()) {
+    auto &seriesNode = m_seriesNodes[series];
+    const auto slices = series->slices();
+    if (seriesNode.slices != slices) {
+        seriesNode.slices = slices;
+        seriesNode.dirty = true;
+        update();
+    }
+
+    for (QPieSlice *slice : slices) {
         QPieSlicePrivate *d = slice->d_func();
-        QQuickShapePath *shapePath = d->m_shapePath;
         QQuickShapePath *labelPath = d->m_labelPath;
         auto labelElements = labelPath->pathElements();
-        auto pathElements = shapePath->pathElements();
         auto labelItem = d->m_labelItem;
 
         if (!m_activeSlices.contains(slice)) {
-            auto data = m_shape->data();
-            data.append(&data, shapePath);
             SliceData sliceData{};
             sliceData.initialized = false;
             m_activeSlices.insert(slice, sliceData);
         }
 
+        // Label arms are only shown for outside labels
         QQuickShape *labelShape = d->m_labelShape;
-        labelShape->setVisible(series->isVisible() && d->m_isLabelVisible);
+        labelShape->setVisible(series->isVisible() && d->m_isLabelVisible
+                               && d->m_labelPosition == QPieSlice::LabelPosition::Outside);
         labelItem->setVisible(series->isVisible() && d->m_isLabelVisible);
 
         if (!series->isVisible()) {
-            pathElements.clear(&pathElements);
-            labelElements.clear(&labelElements);
+            auto &sliceData = m_activeSlices[slice];
+            if (sliceData.generated) {
+                sliceData.generated = false;
+                sliceData.vertices.clear();
+                labelElements.clear(&labelElements);
+                seriesNode.dirty = true;
+                update();
+            }
             continue;
         }
 
-        if (!shapePath->parent())
-            shapePath->setParent(m_shape);
-
         if (!d->m_labelItem->parent()) {
             d->m_labelItem->setParent(this);
             d->m_labelItem->setParentItem(this);
@@ -93,14 +121,11 @@ void PieRenderer::handlePolish(QPieSeries *series)
 
     int sliceIndex = 0;
     QList<QLegendData> legendDataList;
-    for (QPieSlice *slice : series->slices()) {
+    for (QPieSlice *slice : slices) {
         m_painterPath.clear();
 
         QPieSlicePrivate *d = slice->d_func();
 
-        // update slice
-        QQuickShapePath *shapePath = d->m_shapePath;
-
         const auto &borderColors = theme->borderColors();
         int index = sliceIndex % borderColors.size();
         QColor borderColor = borderColors.at(index);
@@ -114,13 +139,38 @@ void PieRenderer::handlePolish(QPieSeries *series)
         QColor color = seriesColors.at(index);
         if (d->m_color.isValid())
             color = d->m_color;
-        shapePath->setStrokeWidth(borderWidth);
-        shapePath->setStrokeColor(borderColor);
-        shapePath->setFillColor(color);
 
-        if (!m_activeSlices.contains(slice))
+        sliceIndex++;
+        legendDataList.push_back({color, borderColor, d->m_labelText});
+
+        auto sliceIt = m_activeSlices.find(slice);
+        if (sliceIt == m_activeSlices.end())
             return;
 
+        SliceGeometry geometry;
+        geometry.center = center;
+        geometry.radius = radius;
+        geometry.holeSize = series->holeSize();
+        geometry.startAngle = slice->startAngle();
+        geometry.angleSpan = slice->angleSpan();
+        geometry.explodeDistance = slice->isExploded()
+                                       ? slice->explodeDistanceFactor() * radius
+                                       : 0.0;
+        geometry.borderWidth = borderWidth;
+        geometry.color = color;
+        geometry.borderColor = borderColor;
+        geometry.labelArmLengthFactor = d->m_labelArmLengthFactor;
+        geometry.labelSize = d->m_labelItem->size();
+        geometry.labelPosition = d->m_labelPosition;
+
+        // Only slices which moved or changed are generated again
+        if (sliceIt->generated && sliceIt->geometry == geometry)
+            continue;
+        sliceIt->generated = true;
+        sliceIt->geometry = geometry;
+        seriesNode.dirty = true;
+        update();
+
         qreal radian = qDegreesToRadians(slice->startAngle());
         qreal startBigX = radius * qSin(radian);
         qreal startBigY = radius * qCos(radian);
@@ -138,33 +188,7 @@ void PieRenderer::handlePolish(QPieSeries *series)
         qreal pointX = startBigY * qSin(radian) + startBigX * qCos(radian);
         qreal pointY = startBigY * qCos(radian) - startBigX * qSin(radian);
 
-        QRectF rect(center.x() - radius + (explodeDistance * qSin(radian)),
-                    center.y() - radius - (explodeDistance * qCos(radian)),
-                    radius * 2,
-                    radius * 2);
-
-        shapePath->setStartX(center.x());
-        shapePath->setStartY(center.y());
-
-        if (series->holeSize() > 0) {
-            QRectF insideRect(center.x() - series->holeSize() * radius
-                                  + (explodeDistance * qSin(radian)),
-                              center.y() - series->holeSize() * radius
-                                  - (explodeDistance * qCos(radian)),
-                              series->holeSize() * radius * 2,
-                              series->holeSize() * radius * 2);
-
-            m_painterPath.arcMoveTo(rect, -slice->startAngle() + 90);
-            m_painterPath.arcTo(rect, -slice->startAngle() + 90, -slice->angleSpan());
-            m_painterPath.arcTo(insideRect,
-                                -slice->startAngle() + 90 - slice->angleSpan(),
-                                slice->angleSpan());
-            m_painterPath.closeSubpath();
-        } else {
-            m_painterPath.moveTo(rect.center());
-            m_painterPath.arcTo(rect, -slice->startAngle() + 90, -slice->angleSpan());
-            m_painterPath.closeSubpath();
-        }
+        updateSliceVertices(*sliceIt, QPointF(xShift, yShift));
 
         radian = qDegreesToRadians(slice->angleSpan());
 
@@ -173,9 +197,6 @@ void PieRenderer::handlePolish(QPieSeries *series)
 
         d->m_largeArc = {xShift + pointX, yShift - pointY};
 
-        shapePath->setPath(m_painterPath);
-        m_painterPath.clear();
-
         radian = qDegreesToRadians(slice->startAngle() + (slice->angleSpan() * .5));
         startBigX = radius * qSin(radian);
         startBigY = radius * qCos(radian);
@@ -195,13 +216,130 @@ void PieRenderer::handlePolish(QPieSeries *series)
 
         d->setLabelPosition(d->m_labelPosition);
         d->m_labelPath->setPath(m_painterPath);
-
-        sliceIndex++;
-        legendDataList.push_back({color, borderColor, d->m_labelText});
     }
     series->d_func()->setLegendData(legendDataList);
 }
 
+void PieRenderer::updateSliceVertices(SliceData &sliceData, QPointF sliceCenter)
+{
+    const SliceGeometry &geometry = sliceData.geometry;
+    const qreal holeRadius = geometry.radius * geometry.holeSize;
+    const int segments = qBound(1,
+                                qCeil(qDegreesToRadians(qAbs(geometry.angleSpan)) * geometry.radius
+                                      / arcSegmentLength),
+                                maxArcSegments);
+
+    // Angles run clockwise from 12 o'clock
+    QVarLengthArray<QPointF, 64> directions;
+    for (int i = 0; i <= segments; ++i) {
+        const qreal radian = qDegreesToRadians(geometry.startAngle
+                                               + geometry.angleSpan * i / segments);
+        directions.append(QPointF(qSin(radian), -qCos(radian)));
+    }
+
+    auto &vertices = sliceData.vertices;
+    vertices.clear();
+    // Adds the triangles of the ring between the radii, with the coverages at each radius
+    auto addRing = [&](qreal radius1, qreal coverage1, qreal radius2, qreal coverage2,
+                       QRgb color) {
+        for (int i = 0; i < segments; ++i) {
+            const QPointF point1 = sliceCenter + radius1 * directions[i];
+            const QPointF point2 = sliceCenter + radius2 * directions[i];
+            const QPointF nextPoint1 = sliceCenter + radius1 * directions[i + 1];
+            const QPointF nextPoint2 = sliceCenter + radius2 * directions[i + 1];
+            appendColoredVertex(vertices, point1, color, coverage1);
+            appendColoredVertex(vertices, nextPoint1, color, coverage1);
+            appendColoredVertex(vertices, point2, color, coverage2);
+            appendColoredVertex(vertices, point2, color, coverage2);
+            appendColoredVertex(vertices, nextPoint1, color, coverage1);
+            appendColoredVertex(vertices, nextPoint2, color, coverage2);
+        }
+    };
+
+    // The arcs fade out over one device pixel across them. The straight edges are left sharp,
+    // so that slices next to each other don't leave a seam between them.
+    const qreal feather = featherWidth(this);
+    const qreal halfFeather = qMin(feather * 0.5, geometry.radius);
+    const qreal outerRadius = geometry.radius - halfFeather;
+    const QRgb color = qPremultiply(geometry.color.rgba());
+    if (holeRadius > 0) {
+        const qreal innerRadius = qMin(holeRadius + halfFeather, outerRadius);
+        addRing(outerRadius, 1.0, innerRadius, 1.0, color);
+        addRing(innerRadius, 1.0, qMax(0.0, holeRadius - halfFeather), 0.0, color);
+    } else {
+        for (int i = 0; i < segments; ++i) {
+            appendColoredVertex(vertices, sliceCenter, color);
+            appendColoredVertex(vertices, sliceCenter + outerRadius * directions[i], color);
+            appendColoredVertex(vertices, sliceCenter + outerRadius * directions[i + 1], color);
+        }
+    }
+    addRing(outerRadius, 1.0, geometry.radius + halfFeather, 0.0, color);
+
+    if (geometry.borderWidth <= 0)
+        return;
+
+    // The border runs along the outer arc and back along the inner arc or through the center
+    QVarLengthArray<QPointF, 130> outline;
+    for (const QPointF &direction : std::as_const(directions))
+        outline.append(sliceCenter + geometry.radius * direction);
+    if (holeRadius > 0) {
+        for (auto it = directions.crbegin(); it != directions.crend(); ++it)
+            outline.append(sliceCenter + holeRadius * *it);
+    } else {
+        outline.append(sliceCenter);
+    }
+
+    strokePolygon(QSpan<const QPointF>(outline.constData(), outline.size()),
+                  geometry.borderWidth,
+                  feather,
+                  qPremultiply(geometry.borderColor.rgba()),
+                  vertices);
+}
+
+void PieRenderer::updateSeriesNode(QSGNode *root, QPieSeries *series, const SeriesNode &seriesNode)
+{
+    qsizetype vertexCount = 0;
+    for (auto slice : std::as_const(seriesNode.slices)) {
+        auto it = m_activeSlices.constFind(slice);
+        if (it != m_activeSlices.cend())
+            vertexCount += it->vertices.size();
+    }
+
+    if (vertexCount == 0) {
+        m_nodes.deleteNode(series);
+        return;
+    }
+
+    auto node = m_nodes.node(root, series);
+    auto geometry = node->geometry();
+    geometry->allocate(vertexCount);
+    auto vertices = geometry->vertexDataAsColoredPoint2D();
+    for (auto slice : std::as_const(seriesNode.slices)) {
+        auto it = m_activeSlices.constFind(slice);
+        if (it != m_activeSlices.cend())
+            vertices = std::copy(it->vertices.cbegin(), it->vertices.cend(), vertices);
+    }
+    node->markDirty(QSGNode::DirtyGeometry);
+}
+
+QSGNode *PieRenderer::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *updatePaintNodeData)
+{
+    Q_UNUSED(updatePaintNodeData);
+
+    const bool recreated = !oldNode;
+    QSGNode *root = recreated ? new QSGNode() : oldNode;
+    m_nodes.sync(recreated);
+
+    for (auto it = m_seriesNodes.begin(); it != m_seriesNodes.end(); ++it) {
+        if (!it->dirty && !recreated)
+            continue;
+        it->dirty = false;
+        updateSeriesNode(root, it.key(), it.value());
+    }
+
+    return root;
+}
+
 void PieRenderer::afterPolish(QList<QAbstractSeries *> &cleanupSeries)
 {
     for (auto series : cleanupSeries) {
@@ -210,16 +348,17 @@ void PieRenderer::afterPolish(QList<QAbstractSeries *> &cleanupSeries)
             for (QPieSlice *slice : pieSeries->slices()) {
                 QPieSlicePrivate *d = slice->d_func();
                 auto labelElements = d->m_labelPath->pathElements();
-                auto shapeElements = d->m_shapePath->pathElements();
 
                 labelElements.clear(&labelElements);
-                shapeElements.clear(&shapeElements);
 
                 slice->deleteLater();
                 d->m_labelItem->deleteLater();
 
                 m_activeSlices.remove(slice);
             }
+            m_seriesNodes.remove(pieSeries);
+            if (m_nodes.release(pieSeries))
+                update();
         }
     }
 }
@@ -250,9 +389,15 @@ void PieRenderer::markedDeleted(QList<QPieSlice *> deleted)
 
     for (auto slice : deleted) {
         auto d = slice->d_func();
-        d->m_shapePath->setPath(emptyPath);
         d->m_labelPath->setPath(emptyPath);
         d->m_labelItem->deleteLater();
         m_activeSlices.remove(slice);
     }
+
+    // The series nodes are generated again without the deleted slices
+    for (auto &seriesNode : m_seriesNodes) {
+        for (auto slice : deleted)
+            seriesNode.dirty |= seriesNode.slices.removeAll(slice) > 0;
+    }
+    update();
 }
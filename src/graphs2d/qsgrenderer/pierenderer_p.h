@@ -15,14 +15,16 @@
 // We mean it.
 
 #include <QQuickItem>
+#include <QtGraphs/qpieslice.h>
 #include <QtGui/qpainterpath.h>
+#include <QtQuick/QSGGeometry>
+#include <private/coloredgeometry_p.h>
 
 QT_BEGIN_NAMESPACE
 
 class QGraphsView;
 class QPieSeries;
 class QPieSlice;
-class QQuickShape;
 class QAbstractSeries;
 
 class PieRenderer : public QQuickItem
@@ -40,15 +42,53 @@ public:
 
     void setSize(QSizeF size);
 
+protected:
+    QSGNode *updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *updatePaintNodeData) override;
+
 private:
+    friend class tst_qgpieseries;
+
+    // Everything the slice triangles and label arm depend on
+    struct SliceGeometry
+    {
+        QPointF center;
+        qreal radius = 0;
+        qreal holeSize = 0;
+        qreal startAngle = 0;
+        qreal angleSpan = 0;
+        qreal explodeDistance = 0;
+        qreal borderWidth = 0;
+        QColor color;
+        QColor borderColor;
+        qreal labelArmLengthFactor = 0;
+        QSizeF labelSize;
+        QPieSlice::LabelPosition labelPosition = QPieSlice::LabelPosition::Outside;
+
+        bool operator==(const SliceGeometry &other) const;
+    };
     struct SliceData
     {
         bool initialized;
+        // Slices are only generated again when their geometry changes
+        bool generated = false;
+        SliceGeometry geometry;
+        // Antialiased fill and border triangles of the slice
+        ColoredVertices vertices;
+    };
+    // The slices of a series are drawn from a single geometry node
+    struct SeriesNode
+    {
+        QList<QPieSlice *> slices;
+        bool dirty = true;
     };
 
+    void updateSliceVertices(SliceData &sliceData, QPointF sliceCenter);
+    void updateSeriesNode(QSGNode *root, QPieSeries *series, const SeriesNode &seriesNode);
+
     QGraphsView *m_graph;
-    QQuickShape *m_shape;
     QHash<QPieSlice *, SliceData> m_activeSlices;
+    QHash<QPieSeries *, SeriesNode> m_seriesNodes;
+    ColoredGeometryNodes m_nodes;
 
     QPainterPath m_painterPath;
     qsizetype m_colorIndex = -1;
@@ -11,10 +11,22 @@
 #include <QtGraphs/qsplineseries.h>
 #endif
 #include <private/axisrenderer_p.h>
+#include <private/charthelpers_p.h>
 #include <private/pointrenderer_p.h>
 #include <private/qabstractseries_p.h>
 #include <private/qgraphsview_p.h>
 #include <private/qxyseries_p.h>
+#include <QtCore/QFuture>
+#include <QtCore/QPromise>
+#include <QtCore/QThreadPool>
+#include <QtGui/private/qbezier_p.h>
+#include <QtGui/qrgb.h>
+#include <QtQuick/QQuickWindow>
+#include <QtQuick/QSGGeometryNode>
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <tuple>
 
 QT_BEGIN_NAMESPACE
 
@@ -27,6 +39,10 @@ static const char *TAG_POINT_VALUE_X = "pointValueX";
 static const char *TAG_POINT_VALUE_Y = "pointValueY";
 static const char *TAG_POINT_INDEX = "pointIndex";
 
+// Each default marker is a border ring of 8 triangles around a fill quad of 2 triangles
+static constexpr int verticesPerMarker = 12;
+static constexpr int indicesPerMarker = 30;
+
 PointRenderer::PointRenderer(QGraphsView *graph)
     : QQuickItem(graph)
     , m_graph(graph)
@@ -34,26 +50,9 @@ PointRenderer::PointRenderer(QGraphsView *graph)
     setFlag(QQuickItem::ItemHasContents);
     setClip(true);
     m_shape.setParentItem(this);
+    // Keep lines below the default markers, which are drawn by this item's own node
+    m_shape.setZ(-1);
     m_shape.setPreferredRendererType(QQuickShape::CurveRenderer);
-
-    const QString qmlData = QLatin1StringView(R"QML(
-        import QtQuick;
-
-        Rectangle {
-            property bool pointSelected
-            property color pointColor
-            property color pointBorderColor
-            property color pointSelectedColor
-            property real pointBorderWidth
-            color: pointSelected ? pointSelectedColor : pointColor
-            border.color: pointBorderColor
-            border.width: pointBorderWidth
-            width: %1
-            height: %1
-        }
-    )QML").arg(QString::number((int) defaultSize()));
-    m_tempMarker = new QQmlComponent(qmlEngine(m_graph), this);
-    m_tempMarker->setData(qmlData.toUtf8(), QUrl());
 }
 
 PointRenderer::~PointRenderer()
@@ -94,6 +93,129 @@ void PointRenderer::calculateRenderCoordinates(
                + m_verticalOffset;
 }
 
+// Returns the same mapping as calculateRenderCoordinates() does
+QTransform PointRenderer::renderTransform(AxisRenderer *axisRenderer) const
+{
+    auto flipX = axisRenderer->m_axisHorizontalMaxValue < axisRenderer->m_axisHorizontalMinValue
+                     ? -1
+                     : 1;
+    auto flipY = axisRenderer->m_axisVerticalMaxValue < axisRenderer->m_axisVerticalMinValue ? -1
+                                                                                             : 1;
+
+    return QTransform(m_areaWidth * flipX * m_maxHorizontal,
+                      0,
+                      0,
+                      -m_areaHeight * flipY * m_maxVertical,
+                      -m_horizontalOffset,
+                      m_areaHeight + m_verticalOffset);
+}
+
+// Visible x range in series coordinates, widened by half a marker so that markers on the
+// edges are kept. Returns false when the points can't be culled, because the series is not
+// sorted by x.
+bool PointRenderer::visibleXRange(QXYSeries *series, PointGroup *group, qreal *left, qreal *right)
+{
+    const QTransform &transform = group->renderTransform;
+    if (transform.m11() == 0 || !series->d_func()->isSortedByX())
+        return false;
+
+    // Point delegates can be larger than the default markers
+    qreal margin = defaultSize(series) / 2.0;
+    for (auto marker : std::as_const(group->markers))
+        margin = qMax(margin, marker->width() / 2.0);
+    for (auto marker : std::as_const(group->previousMarkers))
+        margin = qMax(margin, marker->width() / 2.0);
+    const qreal x1 = (-margin - transform.dx()) / transform.m11();
+    const qreal x2 = (m_areaWidth + margin - transform.dx()) / transform.m11();
+    *left = qMin(x1, x2);
+    *right = qMax(x1, x2);
+    return true;
+}
+
+// Range [first, end) of the count points, sorted by x, which are within [left, right].
+// One more point is kept on each side, so that lines enter and leave the plot correctly.
+template<typename XAt>
+static std::pair<qsizetype, qsizetype> visibleRange(qsizetype count, qreal left, qreal right, XAt xAt)
+{
+    auto partitionPoint = [count](auto predicate) {
+        qsizetype low = 0;
+        qsizetype high = count;
+        while (low < high) {
+            const qsizetype middle = low + (high - low) / 2;
+            if (predicate(middle))
+                low = middle + 1;
+            else
+                high = middle;
+        }
+        return low;
+    };
+    const qsizetype first = partitionPoint([&](qsizetype i) { return xAt(i) < left; });
+    const qsizetype end = partitionPoint([&](qsizetype i) { return xAt(i) <= right; });
+    return {qMax<qsizetype>(first - 1, 0), qMin(end + 1, count)};
+}
+
+// Limits the path of a line to the points [first, end), which are within [left, right].
+// An empty pathIndexes stands for all the points, and gets them listed explicitly.
+static void cullPathIndexes(QList<qsizetype> &pathIndexes,
+                            const QList<QPointF> &points,
+                            qsizetype first,
+                            qsizetype end,
+                            qreal left,
+                            qreal right)
+{
+    if (pathIndexes.isEmpty()) {
+        pathIndexes.resize(end - first);
+        std::iota(pathIndexes.begin(), pathIndexes.end(), first);
+    } else {
+        auto pathX = [&](qsizetype i) { return points.at(pathIndexes.at(i)).x(); };
+        const auto [pathFirst, pathEnd] = visibleRange(pathIndexes.size(), left, right, pathX);
+        pathIndexes = pathIndexes.sliced(pathFirst, pathEnd - pathFirst);
+    }
+}
+
+// Decides how much of the series needs to be processed in this polish. Only the appended
+// points are processed when appending was the only change since the previous polish.
+// Changes to the axis range, the plot size, or the theme always cause a full update, as does
+// any change while a geometry job is running or when points are culled.
+void PointRenderer::prepareUpdate(QXYSeries *series, PointGroup *group)
+{
+    const QTransform transform = renderTransform(m_graph->m_axisRenderer);
+    const qsizetype pointCount = series->points().size();
+    const bool transformChanged = group->renderTransform != transform;
+    group->renderTransform = transform;
+
+    // Only points within the visible x range are processed, when they can be found
+    const bool wasCulled = group->firstVisible > 0 || group->endVisible < group->renderedCount;
+    qsizetype firstVisible = 0;
+    qsizetype endVisible = pointCount;
+    qreal left, right;
+    if (visibleXRange(series, group, &left, &right)) {
+        const auto &&points = series->points();
+        std::tie(firstVisible, endVisible) = visibleRange(pointCount,
+                                                          left,
+                                                          right,
+                                                          [&points](qsizetype i) {
+                                                              return points.at(i).x();
+                                                          });
+    }
+    const bool culled = firstVisible > 0 || endVisible < pointCount;
+
+    const bool appendOnly = !m_themeChanged && !group->geometryJob && !transformChanged
+                            && !culled && !wasCulled
+                            && group->pendingUpdates == group->pendingAppends
+                            && group->renderedCount + group->pendingAppendedPoints == pointCount
+                            && series->type() != QAbstractSeries::SeriesType::Spline
+                            && series->decimationMode() == QXYSeries::DecimationMode::None;
+
+    group->updateFrom = appendOnly ? group->renderedCount : 0;
+    group->firstVisible = firstVisible;
+    group->endVisible = endVisible;
+    group->renderedCount = pointCount;
+    group->pendingUpdates = 0;
+    group->pendingAppends = 0;
+    group->pendingAppendedPoints = 0;
+}
+
 void PointRenderer::reverseRenderCoordinates(
     AxisRenderer *axisRenderer, qreal renderX, qreal renderY, qreal *origX, qreal *origY)
 {
@@ -108,13 +230,39 @@ void PointRenderer::reverseRenderCoordinates(
              / (-1 * m_areaHeight * flipY * m_maxVertical);
 }
 
+// Shows the delegate of a point whose marker is inside the plot area. Points outside of it,
+// or beyond the pointDelegateLimit of the series, get no delegate and an empty rect, so they
+// can't be hovered or pressed either.
 void PointRenderer::updatePointDelegate(
     QXYSeries *series, PointGroup *group, qsizetype pointIndex, qreal x, qreal y)
 {
-    auto theme = m_graph->theme();
-    auto marker = group->markers[pointIndex];
-    auto &rect = group->rects[pointIndex];
+    auto &rect = group->rects[pointIndex - group->rectsOffset];
+    rect = QRectF();
+    const QRectF area(0, 0, m_areaWidth, m_areaHeight);
+    auto markerRectOf = [x, y](QSizeF size) {
+        return QRectF(QPointF(x - size.width() / 2.0, y - size.height() / 2.0), size);
+    };
+    // Delegates without a size are shown when their point is inside
+    auto isInside = [&](QSizeF size) {
+        return size.isEmpty() ? area.contains(QPointF(x, y))
+                              : markerRectOf(size).intersects(area);
+    };
+    // Delegates come from one component, so points can be culled with the size of the
+    // earlier ones without taking a delegate
+    if (group->delegateSize.isValid() && !isInside(group->delegateSize))
+        return;
+
+    auto marker = takePointDelegate(group, pointIndex);
+    if (!marker)
+        return;
+    group->delegateSize = marker->size();
+    if (!isInside(group->delegateSize)) {
+        releasePointDelegate(group, marker);
+        return;
+    }
+    group->markers.insert(pointIndex, marker);
 
+    auto theme = m_graph->theme();
     const auto &seriesColors = theme->seriesColors();
     const auto &borderColors = theme->borderColors();
     qsizetype index = group->colorIndex % seriesColors.size();
@@ -143,26 +291,365 @@ void PointRenderer::updatePointDelegate(
     if (marker->property(TAG_POINT_INDEX).isValid())
         marker->setProperty(TAG_POINT_INDEX, pointIndex);
 
-    marker->setX(x - marker->width() / 2.0);
-    marker->setY(y - marker->height() / 2.0);
+    // The size can depend on the properties set above
+    rect = markerRectOf(marker->size());
+    marker->setX(rect.x());
+    marker->setY(rect.y());
     marker->setVisible(true);
+}
+
+// Delegates only exist for the points inside the plot area. A full update places them all
+// again, so the earlier ones are set aside and reused, preferably for the same points.
+// Appending keeps the delegates of the earlier points.
+void PointRenderer::beginPointDelegates(PointGroup *group)
+{
+    if (group->updateFrom == 0)
+        group->previousMarkers.swap(group->markers);
+}
+
+// Delegates which were not reused are hidden and kept for reuse, like ListView does with
+// reuseItems
+void PointRenderer::endPointDelegates(PointGroup *group)
+{
+    for (auto marker : std::as_const(group->previousMarkers))
+        releasePointDelegate(group, marker);
+    group->previousMarkers.clear();
+}
 
-    rect = QRectF(x - marker->width() / 2.0,
-                  y - marker->height() / 2.0,
-                  marker->width(),
-                  marker->height());
+// Delegate for the point, or nullptr when the pointDelegateLimit of the series is reached
+QQuickItem *PointRenderer::takePointDelegate(PointGroup *group, qsizetype pointIndex)
+{
+    if (auto marker = group->markers.take(pointIndex))
+        return marker;
+    const qsizetype limit = group->series->pointDelegateLimit();
+    if (limit > 0 && group->markers.size() >= limit)
+        return nullptr;
+
+    if (auto marker = group->previousMarkers.take(pointIndex))
+        return marker;
+    if (!group->markerPool.isEmpty())
+        return group->markerPool.takeLast();
+    if (!group->previousMarkers.isEmpty()) {
+        auto it = group->previousMarkers.begin();
+        auto marker = it.value();
+        group->previousMarkers.erase(it);
+        return marker;
+    }
+
+    auto item = qobject_cast<QQuickItem *>(
+        group->currentMarker->create(group->currentMarker->creationContext()));
+    item->setParent(this);
+    item->setParentItem(this);
+    return item;
+}
+
+void PointRenderer::releasePointDelegate(PointGroup *group, QQuickItem *marker)
+{
+    marker->setVisible(false);
+    group->markerPool.append(marker);
+}
+
+void PointRenderer::deletePointDelegates(PointGroup *group)
+{
+    for (auto marker : std::as_const(group->markers))
+        marker->deleteLater();
+    for (auto marker : std::as_const(group->previousMarkers))
+        marker->deleteLater();
+    for (auto marker : std::as_const(group->markerPool))
+        marker->deleteLater();
+    group->markers.clear();
+    group->previousMarkers.clear();
+    group->markerPool.clear();
+    group->delegateSize = QSizeF();
 }
 
 void PointRenderer::hidePointDelegates(QXYSeries *series)
 {
     auto *group = m_groups.value(series);
-    if (group->currentMarker) {
-        for (int i = 0; i < group->markers.size(); ++i) {
-            auto *marker = group->markers[i];
-            marker->setVisible(false);
+    for (auto marker : std::as_const(group->markers))
+        releasePointDelegate(group, marker);
+    group->markers.clear();
+    group->rects.clear();
+    if (group->defaultMarkers) {
+        group->markersDirty = true;
+        update();
+    }
+}
+
+void PointRenderer::updateMarkerStyle(QXYSeries *series, PointGroup *group)
+{
+    // Same look as a Rectangle marker with pointColor, pointBorderColor,
+    // pointBorderWidth and pointSelectedColor applied
+    auto theme = m_graph->theme();
+    const auto &seriesColors = theme->seriesColors();
+    const auto &borderColors = theme->borderColors();
+    qsizetype index = group->colorIndex % seriesColors.size();
+    group->markerColor = series->color().alpha() != 0 ? series->color() : seriesColors.at(index);
+    index = group->colorIndex % borderColors.size();
+    group->markerBorderColor = borderColors.at(index);
+    group->markerBorderWidth = theme->borderWidth();
+    group->markerSelectedColor = series->selectedColor().alpha() != 0
+                                     ? series->selectedColor()
+                                     : theme->singleHighlightColor();
+    const auto selectedPoints = series->selectedPoints();
+    group->selectedMarkers = QSet<qsizetype>(selectedPoints.cbegin(), selectedPoints.cend());
+}
+
+void PointRenderer::updateDefaultMarkers(QXYSeries *series, PointGroup *group)
+{
+    updateMarkerStyle(series, group);
+    group->markerVertices.clear();
+    group->markerIndices.clear();
+    group->markersDirty = true;
+    update();
+}
+
+// The first rect is the marker of point rectsOffset
+static void fillMarkerGeometry(const QList<QRectF> &rects,
+                               qsizetype rectsOffset,
+                               const QSet<qsizetype> &selectedMarkers,
+                               QColor markerColor,
+                               QColor markerSelectedColor,
+                               QColor markerBorderColor,
+                               qreal markerBorderWidth,
+                               QSGGeometry::ColoredPoint2D *vertices,
+                               quint32 *indices)
+{
+    const QRgb borderColor = qPremultiply(markerBorderColor.rgba());
+    const QRgb color = qPremultiply(markerColor.rgba());
+    const QRgb selectedColor = qPremultiply(markerSelectedColor.rgba());
+
+    for (qsizetype i = 0; i < rects.size(); ++i) {
+        const QRectF &outer = rects.at(i);
+        const qreal borderWidth = qMin(markerBorderWidth, qMin(outer.width(), outer.height()) / 2.0);
+        const QRectF inner = outer.adjusted(borderWidth, borderWidth, -borderWidth, -borderWidth);
+        const QRgb fillColor = selectedMarkers.contains(rectsOffset + i) ? selectedColor : color;
+
+        auto v = vertices + i * verticesPerMarker;
+        // Outer and inner corners of the border, clockwise from top-left
+        setColoredVertex(v + 0, outer.topLeft(), borderColor);
+        setColoredVertex(v + 1, outer.topRight(), borderColor);
+        setColoredVertex(v + 2, outer.bottomRight(), borderColor);
+        setColoredVertex(v + 3, outer.bottomLeft(), borderColor);
+        setColoredVertex(v + 4, inner.topLeft(), borderColor);
+        setColoredVertex(v + 5, inner.topRight(), borderColor);
+        setColoredVertex(v + 6, inner.bottomRight(), borderColor);
+        setColoredVertex(v + 7, inner.bottomLeft(), borderColor);
+        // Fill
+        setColoredVertex(v + 8, inner.topLeft(), fillColor);
+        setColoredVertex(v + 9, inner.topRight(), fillColor);
+        setColoredVertex(v + 10, inner.bottomRight(), fillColor);
+        setColoredVertex(v + 11, inner.bottomLeft(), fillColor);
+
+        const quint32 base = quint32(i * verticesPerMarker);
+        auto idx = indices + i * indicesPerMarker;
+        for (quint32 edge = 0; edge < 4; ++edge) {
+            const quint32 next = (edge + 1) % 4;
+            *idx++ = base + edge;
+            *idx++ = base + next;
+            *idx++ = base + 4 + edge;
+            *idx++ = base + 4 + edge;
+            *idx++ = base + next;
+            *idx++ = base + 4 + next;
         }
+        *idx++ = base + 8;
+        *idx++ = base + 9;
+        *idx++ = base + 10;
+        *idx++ = base + 8;
+        *idx++ = base + 10;
+        *idx++ = base + 11;
     }
-    group->rects.clear();
+}
+
+void PointRenderer::updateMarkerNode(QSGNode *root, QXYSeries *series, PointGroup *group)
+{
+    const qsizetype markerCount = group->defaultMarkers ? group->rects.size() : 0;
+    if (markerCount == 0) {
+        m_markerNodes.deleteNode(series);
+        return;
+    }
+
+    auto node = m_markerNodes.node(root, series);
+    auto geometry = node->geometry();
+    geometry->allocate(markerCount * verticesPerMarker, markerCount * indicesPerMarker);
+    auto vertices = geometry->vertexDataAsColoredPoint2D();
+    auto indices = geometry->indexDataAsUInt();
+
+    // Geometry prepared by a geometry job only needs to be copied
+    if (group->markerVertices.size() == markerCount * verticesPerMarker
+        && group->markerIndices.size() == markerCount * indicesPerMarker) {
+        std::copy(group->markerVertices.cbegin(), group->markerVertices.cend(), vertices);
+        std::copy(group->markerIndices.cbegin(), group->markerIndices.cend(), indices);
+    } else {
+        fillMarkerGeometry(group->rects,
+                           group->rectsOffset,
+                           group->selectedMarkers,
+                           group->markerColor,
+                           group->markerSelectedColor,
+                           group->markerBorderColor,
+                           group->markerBorderWidth,
+                           vertices,
+                           indices);
+    }
+
+    node->markDirty(QSGNode::DirtyGeometry);
+}
+
+bool PointRenderer::useGeometryJob(QXYSeries *series, PointGroup *group) const
+{
+    // Point delegates are items, and spline paths need the control points of the series,
+    // so only lines and default markers are prepared on a worker thread
+    return !group->currentMarker && series->type() != QAbstractSeries::SeriesType::Spline
+           && series->count() >= AsyncGeometryThreshold;
+}
+
+void PointRenderer::startGeometryJob(QXYSeries *series,
+                                     PointGroup *group,
+                                     GeometrySnapshot &&snapshot)
+{
+    // Only one job runs at a time for a series, the latest changes are picked up
+    // by the next one
+    if (group->geometryJob) {
+        group->geometryRerun = true;
+        return;
+    }
+
+    // The job gets its own copy of the points. Sharing them with the series while the job
+    // runs would make the next change to the series copy all of them, like dropping the
+    // oldest points of a sliding window does.
+    snapshot.points.detach();
+    snapshot.transform = group->renderTransform;
+    snapshot.area = size();
+    snapshot.markerSize = defaultSize(series);
+
+    const quint64 job = ++m_lastGeometryJob;
+    group->geometryJob = job;
+
+    auto promise = std::make_shared<QPromise<GeometryResult>>();
+    QFuture<GeometryResult> future = promise->future();
+    QThreadPool::globalInstance()->start([promise, snapshot = std::move(snapshot)]() {
+        promise->start();
+        promise->addResult(prepareGeometry(snapshot));
+        promise->finish();
+    });
+    // Dropped if the renderer is destroyed before the job has finished
+    future.then(this, [this, series, job](GeometryResult result) {
+        applyGeometryJob(series, job, std::move(result));
+    });
+}
+
+// Runs on the GUI thread once a geometry job has finished
+void PointRenderer::applyGeometryJob(QXYSeries *series, quint64 job, GeometryResult &&result)
+{
+    auto group = m_groups.value(series);
+    if (!group || group->geometryJob != job)
+        return;
+    group->geometryJob = 0;
+
+    group->rects = std::move(result.rects);
+    group->rectsOffset = result.rectsOffset;
+    group->hitGrid = std::move(result.hitGrid);
+    if (group->shapePath) {
+        group->pathIndexes = std::move(result.pathIndexes);
+        group->painterPath = std::move(result.painterPath);
+        group->shapePath->setPath(group->painterPath);
+    }
+    if (group->defaultMarkers) {
+        group->markerVertices = std::move(result.markerVertices);
+        group->markerIndices = std::move(result.markerIndices);
+        group->markersDirty = true;
+        update();
+    }
+
+    if (group->geometryRerun) {
+        // The series changed while the job was running, so prepare it again from scratch
+        group->geometryRerun = false;
+        ++group->pendingUpdates;
+        m_graph->polishSeries(series);
+    }
+}
+
+// Runs on a worker thread, so only the snapshot may be used
+PointRenderer::GeometryResult PointRenderer::prepareGeometry(const GeometrySnapshot &snapshot)
+{
+    GeometryResult result;
+
+    QList<QPointF> mapped;
+    mapPoints(QSpan<const QPointF>(snapshot.points).subspan(snapshot.first,
+                                                            snapshot.end - snapshot.first),
+              snapshot.transform,
+              mapped);
+
+    const qreal size = snapshot.markerSize;
+    result.rects.resize(mapped.size());
+    result.rectsOffset = snapshot.first;
+    for (qsizetype i = 0; i < mapped.size(); ++i) {
+        const QPointF &point = mapped.at(i);
+        result.rects[i] = QRectF(point.x() - size / 2.0, point.y() - size / 2.0, size, size);
+    }
+    result.hitGrid.update(result.rects, snapshot.area);
+
+    if (snapshot.buildPath) {
+        // Decimated here as well, like QXYSeriesPrivate::decimatedIndexes() does for the
+        // series, which is not used from this thread
+        auto &pathIndexes = result.pathIndexes;
+        if (snapshot.decimationMode == QXYSeries::DecimationMode::PixelMinMax) {
+            QXYSeriesPrivate::decimatePixelMinMax(snapshot.points,
+                                                  snapshot.decimationScale,
+                                                  snapshot.decimationOffset,
+                                                  pathIndexes);
+        } else if (snapshot.decimationMode
+                   == QXYSeries::DecimationMode::LargestTriangleThreeBuckets) {
+            QXYSeriesPrivate::decimateLargestTriangleThreeBuckets(snapshot.points,
+                                                                  snapshot.decimationTarget,
+                                                                  pathIndexes);
+        }
+        if (snapshot.first > 0 || snapshot.end < snapshot.points.size()) {
+            cullPathIndexes(pathIndexes,
+                            snapshot.points,
+                            snapshot.first,
+                            snapshot.end,
+                            snapshot.visibleLeft,
+                            snapshot.visibleRight);
+        }
+
+        auto &painterPath = result.painterPath;
+        if (pathIndexes.isEmpty()) {
+            painterPath.reserve(mapped.size());
+            for (qsizetype i = 0; i < mapped.size(); ++i) {
+                if (i == 0)
+                    painterPath.moveTo(mapped.at(i));
+                else
+                    painterPath.lineTo(mapped.at(i));
+            }
+        } else {
+            // Listed points can be outside of the mapped ones, so they are mapped separately
+            painterPath.reserve(pathIndexes.size());
+            for (qsizetype i = 0; i < pathIndexes.size(); ++i) {
+                const QPointF point = snapshot.transform.map(snapshot.points.at(pathIndexes.at(i)));
+                if (i == 0)
+                    painterPath.moveTo(point);
+                else
+                    painterPath.lineTo(point);
+            }
+        }
+    }
+
+    if (snapshot.buildMarkers) {
+        result.markerVertices.resize(result.rects.size() * verticesPerMarker);
+        result.markerIndices.resize(result.rects.size() * indicesPerMarker);
+        fillMarkerGeometry(result.rects,
+                           result.rectsOffset,
+                           snapshot.selectedMarkers,
+                           snapshot.markerColor,
+                           snapshot.markerSelectedColor,
+                           snapshot.markerBorderColor,
+                           snapshot.markerBorderWidth,
+                           result.markerVertices.data(),
+                           result.markerIndices.data());
+    }
+
+    return result;
 }
 
 void PointRenderer::updateLegendData(QXYSeries *series, QLegendData &legendData)
@@ -177,18 +664,47 @@ void PointRenderer::updateScatterSeries(QScatterSeries *series, QLegendData &leg
     if (series->isVisible()) {
         auto group = m_groups.value(series);
         auto &&points = series->points();
-        group->rects.resize(points.size());
-        for (int i = 0; i < points.size(); ++i) {
-            qreal x, y;
-            calculateRenderCoordinates(m_graph->m_axisRenderer, points[i].x(), points[i].y(), &x, &y);
+        if (useGeometryJob(series, group)) {
+            GeometrySnapshot snapshot;
+            snapshot.points = points;
+            snapshot.first = group->firstVisible;
+            snapshot.end = group->endVisible;
+            if (group->defaultMarkers) {
+                updateMarkerStyle(series, group);
+                snapshot.buildMarkers = true;
+                snapshot.selectedMarkers = group->selectedMarkers;
+                snapshot.markerColor = group->markerColor;
+                snapshot.markerSelectedColor = group->markerSelectedColor;
+                snapshot.markerBorderColor = group->markerBorderColor;
+                snapshot.markerBorderWidth = group->markerBorderWidth;
+            }
+            startGeometryJob(series, group, std::move(snapshot));
+            legendData = {series->color(), series->color(), series->name()};
+            return;
+        }
+
+        const qsizetype first = group->firstVisible;
+        const qsizetype from = qMax(group->updateFrom, first);
+        const qsizetype end = group->endVisible;
+        group->rects.resize(end - first);
+        group->rectsOffset = first;
+        mapPoints(QSpan<const QPointF>(std::as_const(points)).subspan(from, end - from),
+                  group->renderTransform,
+                  m_mappedPoints);
+        const qreal size = defaultSize(series);
+        for (qsizetype i = from; i < end; ++i) {
+            const QPointF &mapped = m_mappedPoints.at(i - from);
+            const qreal x = mapped.x();
+            const qreal y = mapped.y();
             if (group->currentMarker) {
                 updatePointDelegate(series, group, i, x, y);
             } else {
-                auto &rect = group->rects[i];
-                qreal size = defaultSize(series);
+                auto &rect = group->rects[i - first];
                 rect = QRectF(x - size / 2.0, y - size / 2.0, size, size);
             }
         }
+        if (group->defaultMarkers && (group->updateFrom == 0 || group->updateFrom < end))
+            updateDefaultMarkers(series, group);
     } else {
         hidePointDelegates(series);
     }
@@ -221,28 +737,92 @@ void PointRenderer::updateLineSeries(QLineSeries *series, QLegendData &legendDat
         group->shapePath->setCapStyle(QQuickShapePath::CapStyle::RoundCap);
 
     auto &painterPath = group->painterPath;
-    painterPath.clear();
 
     if (series->isVisible()) {
         auto &&points = series->points();
-        group->rects.resize(points.size());
-        for (int i = 0; i < points.size(); ++i) {
-            qreal x, y;
-            calculateRenderCoordinates(m_graph->m_axisRenderer, points[i].x(), points[i].y(), &x, &y);
-            if (i == 0)
-                painterPath.moveTo(x, y);
-            else
-                painterPath.lineTo(x, y);
+        // Bucket by device pixel columns, using the same mapping as calculateRenderCoordinates
+        auto axisRenderer = m_graph->m_axisRenderer;
+        const qreal flipX = axisRenderer->m_axisHorizontalMaxValue
+                                    < axisRenderer->m_axisHorizontalMinValue
+                                ? -1
+                                : 1;
+        const qreal dpr = window() ? window()->effectiveDevicePixelRatio() : 1.0;
+        const qreal decimationScale = m_areaWidth * flipX * m_maxHorizontal * dpr;
+        const qreal decimationOffset = m_horizontalOffset * dpr;
+
+        const qsizetype first = group->firstVisible;
+        const qsizetype end = group->endVisible;
+        // Only the visible part of the path is built, so its points are listed explicitly
+        const bool culled = first > 0 || end < points.size();
+        qreal left = 0;
+        qreal right = 0;
+        if (culled)
+            visibleXRange(series, group, &left, &right);
+
+        if (useGeometryJob(series, group)) {
+            GeometrySnapshot snapshot;
+            snapshot.points = points;
+            snapshot.first = first;
+            snapshot.end = end;
+            snapshot.decimationMode = series->decimationMode();
+            snapshot.decimationTarget = series->decimationTarget();
+            snapshot.decimationScale = decimationScale;
+            snapshot.decimationOffset = decimationOffset;
+            snapshot.visibleLeft = left;
+            snapshot.visibleRight = right;
+            snapshot.buildPath = true;
+            startGeometryJob(series, group, std::move(snapshot));
+            legendData = {color, color, series->name()};
+            return;
+        }
+
+        auto pathIndexes = series->d_func()->decimatedIndexes(decimationScale, decimationOffset);
+        if (culled)
+            cullPathIndexes(pathIndexes, points, first, end, left, right);
+
+        if (group->updateFrom == 0)
+            painterPath.clear();
+        group->pathIndexes = std::move(pathIndexes);
+        const bool pathFromIndexes = !group->pathIndexes.isEmpty();
+
+        const qsizetype from = qMax(group->updateFrom, first);
+        group->rects.resize(end - first);
+        group->rectsOffset = first;
+        mapPoints(QSpan<const QPointF>(std::as_const(points)).subspan(from, end - from),
+                  group->renderTransform,
+                  m_mappedPoints);
+        const qreal size = defaultSize(series);
+        for (qsizetype i = from; i < end; ++i) {
+            const QPointF &mapped = m_mappedPoints.at(i - from);
+            const qreal x = mapped.x();
+            const qreal y = mapped.y();
+            if (!pathFromIndexes) {
+                if (i == 0)
+                    painterPath.moveTo(x, y);
+                else
+                    painterPath.lineTo(x, y);
+            }
 
             if (group->currentMarker) {
                 updatePointDelegate(series, group, i, x, y);
             } else {
-                auto &rect = group->rects[i];
-                qreal size = defaultSize(series);
+                auto &rect = group->rects[i - first];
                 rect = QRectF(x - size / 2.0, y - size / 2.0, size, size);
             }
         }
+
+        for (qsizetype i = 0; i < group->pathIndexes.size(); ++i) {
+            const QPointF &point = points[group->pathIndexes[i]];
+            qreal x, y;
+            calculateRenderCoordinates(m_graph->m_axisRenderer, point.x(), point.y(), &x, &y);
+            if (i == 0)
+                painterPath.moveTo(x, y);
+            else
+                painterPath.lineTo(x, y);
+        }
     } else {
+        if (group->updateFrom == 0)
+            painterPath.clear();
         hidePointDelegates(series);
     }
     group->shapePath->setPath(painterPath);
@@ -277,36 +857,105 @@ void PointRenderer::updateSplineSeries(QSplineSeries *series, QLegendData &legen
 
     if (series->isVisible()) {
         auto &&points = series->points();
-        group->rects.resize(points.size());
         auto fittedPoints = series->getControlPoints();
 
-        for (int i = 0, j = 0; i < points.size(); ++i, ++j) {
+        // Control points are fitted through the decimated points when decimation is used
+        const auto decimatedIndexes = series->d_func()->decimatedIndexes(0, 0);
+        auto pathPoint = [&](qsizetype i) -> const QPointF & {
+            return decimatedIndexes.isEmpty() ? points[i] : points[decimatedIndexes[i]];
+        };
+        qsizetype pathFirst = 0;
+        qsizetype pathEnd = decimatedIndexes.isEmpty() ? points.size() : decimatedIndexes.size();
+
+        // Only the segments within the visible x range are built, and the path then lists
+        // its points explicitly
+        const bool culled = group->firstVisible > 0 || group->endVisible < points.size();
+        if (culled) {
+            qreal left, right;
+            visibleXRange(series, group, &left, &right);
+            auto pathX = [&](qsizetype i) { return pathPoint(i).x(); };
+            std::tie(pathFirst, pathEnd) = visibleRange(pathEnd, left, right, pathX);
+            group->pathIndexes.resize(pathEnd - pathFirst);
+            for (qsizetype i = pathFirst; i < pathEnd; ++i) {
+                group->pathIndexes[i - pathFirst] = decimatedIndexes.isEmpty()
+                                                        ? i
+                                                        : decimatedIndexes[i];
+            }
+        } else {
+            group->pathIndexes = decimatedIndexes;
+        }
+        const qsizetype pathPointCount = pathEnd - pathFirst;
+
+        // The path is also flattened for hover, with the first polyline index of each segment
+        auto &polyline = group->splinePolyline;
+        auto &segmentStarts = group->splineSegmentStarts;
+        polyline.clear();
+        segmentStarts.clear();
+        segmentStarts.reserve(pathPointCount);
+        QPointF previous;
+
+        for (qsizetype i = pathFirst; i < pathEnd; ++i) {
+            const QPointF &point = pathPoint(i);
             qreal x, y;
-            calculateRenderCoordinates(m_graph->m_axisRenderer, points[i].x(), points[i].y(), &x, &y);
+            calculateRenderCoordinates(m_graph->m_axisRenderer, point.x(), point.y(), &x, &y);
 
-            if (i == 0) {
+            if (i == pathFirst) {
                 painterPath.moveTo(x, y);
+                polyline.append(QPointF(x, y));
             } else {
+                // The segment ending at path point i has control points 2 * i - 2 and 2 * i - 1
                 qreal x1, y1, x2, y2;
                 calculateRenderCoordinates(m_graph->m_axisRenderer,
-                                           fittedPoints[j - 1].x(),
-                                           fittedPoints[j - 1].y(),
+                                           fittedPoints[2 * i - 2].x(),
+                                           fittedPoints[2 * i - 2].y(),
                                            &x1,
                                            &y1);
                 calculateRenderCoordinates(m_graph->m_axisRenderer,
-                                           fittedPoints[j].x(),
-                                           fittedPoints[j].y(),
+                                           fittedPoints[2 * i - 1].x(),
+                                           fittedPoints[2 * i - 1].y(),
                                            &x2,
                                            &y2);
                 painterPath.cubicTo(x1, y1, x2, y2, x, y);
-                ++j;
+                segmentStarts.append(polyline.size() - 1);
+                QBezier::fromPoints(previous, QPointF(x1, y1), QPointF(x2, y2), QPointF(x, y))
+                    .addToPolygon(&polyline);
+            }
+            previous = QPointF(x, y);
+        }
+        segmentStarts.append(polyline.size() - 1);
+
+        group->splineSegmentBounds.resize(pathPointCount > 0 ? pathPointCount - 1 : 0);
+        for (qsizetype i = 0; i < group->splineSegmentBounds.size(); ++i) {
+            qreal left = polyline.at(segmentStarts.at(i)).x();
+            qreal right = left;
+            qreal top = polyline.at(segmentStarts.at(i)).y();
+            qreal bottom = top;
+            for (qsizetype k = segmentStarts.at(i) + 1; k <= segmentStarts.at(i + 1); ++k) {
+                const QPointF &p = polyline.at(k);
+                left = qMin(left, p.x());
+                right = qMax(right, p.x());
+                top = qMin(top, p.y());
+                bottom = qMax(bottom, p.y());
             }
+            group->splineSegmentBounds[i] = QRectF(QPointF(left, top), QPointF(right, bottom));
+        }
+
+        const qsizetype first = group->firstVisible;
+        const qsizetype end = group->endVisible;
+        group->rects.resize(end - first);
+        group->rectsOffset = first;
+        mapPoints(QSpan<const QPointF>(std::as_const(points)).subspan(first, end - first),
+                  group->renderTransform,
+                  m_mappedPoints);
+        const qreal size = defaultSize(series);
+        for (qsizetype i = first; i < end; ++i) {
+            const qreal x = m_mappedPoints.at(i - first).x();
+            const qreal y = m_mappedPoints.at(i - first).y();
 
             if (group->currentMarker) {
                 updatePointDelegate(series, group, i, x, y);
             } else {
-                auto &rect = group->rects[i];
-                qreal size = defaultSize(series);
+                auto &rect = group->rects[i - first];
                 rect = QRectF(x - size / 2.0, y - size / 2.0, size, size);
             }
         }
@@ -338,10 +987,21 @@ void PointRenderer::handlePolish(QXYSeries *series)
                 group->shapePath->setPath(painterPath);
             }
 
-            for (auto m : group->markers)
-                m->deleteLater();
-
-            group->markers.clear();
+            deletePointDelegates(group);
+            group->rects.clear();
+            group->rectsOffset = 0;
+            group->hitGrid.clear();
+            group->renderedCount = 0;
+            group->firstVisible = 0;
+            group->endVisible = 0;
+            group->pendingUpdates = 1;
+            group->geometryJob = 0;
+            group->geometryRerun = false;
+
+            if (group->defaultMarkers) {
+                group->markersDirty = true;
+                update();
+            }
         }
 
         return;
@@ -374,11 +1034,42 @@ void PointRenderer::handlePolish(QXYSeries *series)
 
     m_horizontalOffset = (hmin / m_graph->m_axisRenderer->m_axisHorizontalValueRange) * m_areaWidth;
 
+    if (m_theme != theme) {
+        QObject::disconnect(m_themeConnection);
+        m_theme = theme;
+        m_themeConnection = QObject::connect(theme, &QGraphsTheme::update, this, [this]() {
+            m_themeChanged = true;
+        });
+        m_themeChanged = true;
+    }
+
     if (!m_groups.contains(series)) {
         PointGroup *group = new PointGroup();
         group->series = series;
         m_groups.insert(series, group);
 
+        QObject::connect(series, &QAbstractSeries::update, this, [this, series]() {
+            if (auto group = m_groups.value(series))
+                ++group->pendingUpdates;
+        });
+        QObject::connect(series, &QXYSeries::pointAdded, this, [this, series](qsizetype index) {
+            auto group = m_groups.value(series);
+            if (group && index == series->count() - 1) {
+                ++group->pendingAppends;
+                ++group->pendingAppendedPoints;
+            }
+        });
+        QObject::connect(series,
+                         &QXYSeries::pointsAdded,
+                         this,
+                         [this, series](qsizetype index, qsizetype count) {
+                             auto group = m_groups.value(series);
+                             if (group && index + count == series->count()) {
+                                 ++group->pendingAppends;
+                                 group->pendingAppendedPoints += count;
+                             }
+                         });
+
         if (series->type() != QAbstractSeries::SeriesType::Scatter) {
             group->shapePath = new QQuickShapePath(&m_shape);
             group->shapePath->setAsynchronous(true);
@@ -389,46 +1080,37 @@ void PointRenderer::handlePolish(QXYSeries *series)
 
     auto group = m_groups.value(series);
 
-    qsizetype pointCount = series->points().size();
-
-    if ((series->type() == QAbstractSeries::SeriesType::Scatter) && !series->pointDelegate())
-        group->currentMarker = m_tempMarker;
-    else if (series->pointDelegate())
-        group->currentMarker = series->pointDelegate();
-
-    if (group->currentMarker != group->previousMarker) {
-        for (auto &&marker : group->markers)
-            marker->deleteLater();
-        group->markers.clear();
+    // Scatter points without a pointDelegate are drawn by the default marker node
+    group->currentMarker = series->pointDelegate();
+    const bool defaultMarkers = (series->type() == QAbstractSeries::SeriesType::Scatter)
+                                && !group->currentMarker;
+    if (group->defaultMarkers != defaultMarkers) {
+        group->defaultMarkers = defaultMarkers;
+        group->markersDirty = true;
+        update();
     }
-    group->previousMarker = group->currentMarker;
 
-    if (group->currentMarker) {
-        qsizetype markerCount = group->markers.size();
-        if (markerCount < pointCount) {
-            for (qsizetype i = markerCount; i < pointCount; ++i) {
-                QQuickItem *item = qobject_cast<QQuickItem *>(
-                    group->currentMarker->create(group->currentMarker->creationContext()));
-                item->setParent(this);
-                item->setParentItem(this);
-                group->markers << item;
-            }
-        } else if (markerCount > pointCount) {
-            for (qsizetype i = pointCount; i < markerCount; ++i)
-                group->markers[i]->deleteLater();
-            group->markers.resize(pointCount);
-        }
-    } else if (group->markers.size() > 0) {
-        for (auto &&marker : group->markers)
-            marker->deleteLater();
-        group->markers.clear();
-    }
+    if (group->currentMarker != group->previousMarker || !group->currentMarker)
+        deletePointDelegates(group);
+    group->previousMarker = group->currentMarker;
 
     if (group->colorIndex < 0) {
         group->colorIndex = m_graph->graphSeriesCount();
         m_graph->setGraphSeriesCount(group->colorIndex + 1);
     }
 
+    prepareUpdate(series, group);
+
+    if (group->currentMarker)
+        beginPointDelegates(group);
+
+    // Drop the result of a running geometry job when the series is updated here instead
+    const bool geometryJob = series->isVisible() && useGeometryJob(series, group);
+    if (!geometryJob) {
+        group->geometryJob = 0;
+        group->geometryRerun = false;
+    }
+
     QLegendData legendData;
 #ifdef USE_SCATTERGRAPH
     if (auto scatter = qobject_cast<QScatterSeries *>(series))
@@ -449,18 +1131,25 @@ void PointRenderer::handlePolish(QXYSeries *series)
         updateSplineSeries(spline, legendData);
 #endif
 
+    if (group->currentMarker)
+        endPointDelegates(group);
+
+    if (!geometryJob)
+        group->hitGrid.update(group->rects, size(), group->updateFrom);
+
     updateLegendData(series, legendData);
 }
 
 void PointRenderer::afterPolish(QList<QAbstractSeries *> &cleanupSeries)
 {
+    m_themeChanged = false;
+
     for (auto series : cleanupSeries) {
         auto xySeries = qobject_cast<QXYSeries *>(series);
         if (xySeries && m_groups.contains(xySeries)) {
             auto group = m_groups.value(xySeries);
 
-            for (auto marker : group->markers)
-                marker->deleteLater();
+            deletePointDelegates(group);
 
             if (group->shapePath) {
                 auto painterPath = group->painterPath;
@@ -468,12 +1157,36 @@ void PointRenderer::afterPolish(QList<QAbstractSeries *> &cleanupSeries)
                 group->shapePath->setPath(painterPath);
             }
 
+            if (m_markerNodes.release(xySeries))
+                update();
+
+            QObject::disconnect(xySeries, nullptr, this, nullptr);
+
             delete group;
             m_groups.remove(xySeries);
         }
     }
 }
 
+QSGNode *PointRenderer::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *updatePaintNodeData)
+{
+    Q_UNUSED(updatePaintNodeData);
+
+    const bool recreated = !oldNode;
+    QSGNode *root = recreated ? new QSGNode() : oldNode;
+    m_markerNodes.sync(recreated);
+
+    for (auto it = m_groups.cbegin(); it != m_groups.cend(); ++it) {
+        auto group = it.value();
+        if (!group->markersDirty && !recreated)
+            continue;
+        group->markersDirty = false;
+        updateMarkerNode(root, it.key(), group);
+    }
+
+    return root;
+}
+
 void PointRenderer::updateSeries(QXYSeries *series)
 {
     Q_UNUSED(series);
@@ -525,16 +1238,15 @@ bool PointRenderer::handleMousePress(QMouseEvent *event)
         if (!group->series->isSelectable() && !group->series->isDraggable())
             continue;
 
-        int index = 0;
-        for (auto &&rect : group->rects) {
-            if (rect.contains(event->pos())) {
-                m_pointPressed = true;
-                m_pressStart = event->pos();
-                m_pressedGroup = group;
-                m_pressedPointIndex = index;
-                handled = true;
-            }
-            index++;
+        // The topmost point wins when markers overlap. The rects can be from before the
+        // latest change to the series while a geometry job is running.
+        const auto indexes = group->hitGrid.indexesAt(group->rects, event->pos());
+        if (!indexes.isEmpty() && group->rectsOffset + indexes.last() < group->series->count()) {
+            m_pointPressed = true;
+            m_pressStart = event->pos();
+            m_pressedGroup = group;
+            m_pressedPointIndex = group->rectsOffset + indexes.last();
+            handled = true;
         }
     }
     return handled;
@@ -545,7 +1257,9 @@ bool PointRenderer::handleMouseRelease(QMouseEvent *event)
     bool handled = false;
     if (!m_pointDragging && m_pointPressed && m_pressedGroup
         && m_pressedGroup->series->isSelectable() && m_pressedGroup->series->isVisible()) {
-        if (m_pressedGroup->rects[m_pressedPointIndex].contains(event->pos())) {
+        const qsizetype rectIndex = m_pressedPointIndex - m_pressedGroup->rectsOffset;
+        if (rectIndex >= 0 && rectIndex < m_pressedGroup->rects.size()
+            && m_pressedGroup->rects[rectIndex].contains(event->pos())) {
             if (m_pressedGroup->series->isPointSelected(m_pressedPointIndex)) {
                 m_pressedGroup->series->deselectPoint(m_pressedPointIndex);
             } else {
@@ -579,17 +1293,17 @@ bool PointRenderer::handleHoverMove(QHoverEvent *event)
 
             bool hovering = false;
 
-            int index = 0;
-            for (auto &&rect : group->rects) {
-                if (rect.contains(position.toPoint())) {
-                    if (!group->hover) {
-                        group->hover = true;
-                        emit group->series->hoverEnter(name, position, group->series->at(index));
-                    }
-                    emit group->series->hover(name, position, group->series->at(index));
-                    hovering = true;
+            const auto indexes = group->hitGrid.indexesAt(group->rects, position.toPoint());
+            for (qsizetype rectIndex : indexes) {
+                const qsizetype index = group->rectsOffset + rectIndex;
+                if (index >= group->series->count())
+                    break;
+                if (!group->hover) {
+                    group->hover = true;
+                    emit group->series->hoverEnter(name, position, group->series->at(index));
                 }
-                index++;
+                emit group->series->hover(name, position, group->series->at(index));
+                hovering = true;
             }
 
             if (!hovering && group->hover) {
@@ -605,11 +1319,61 @@ bool PointRenderer::handleHoverMove(QHoverEvent *event)
             auto &&points = group->series->points();
             // True when line, false when spline
             const bool isLine = group->series->type() == QAbstractSeries::SeriesType::Line;
-            if (points.size() >= 2) {
+            // The path may be built from a decimated set of points, map back to the originals
+            const auto &pathIndexes = group->pathIndexes;
+            const qsizetype pathPointCount = pathIndexes.isEmpty() ? points.size()
+                                                                   : pathIndexes.size();
+            auto pointIndex = [&pathIndexes](qsizetype pathIndex) {
+                return pathIndexes.isEmpty() ? pathIndex : pathIndexes[pathIndex];
+            };
+            // The flattened spline is only valid once the path has been updated, and the line
+            // path may be from before the latest change while a geometry job is running
+            const bool pathReady = isLine ? group->painterPath.elementCount() == pathPointCount
+                                                && (pathIndexes.isEmpty()
+                                                    || pathIndexes.last() < points.size())
+                                          : group->splineSegmentStarts.size() == pathPointCount;
+            if (pathPointCount >= 2 && pathReady) {
                 bool hovering = false;
-                auto subpath = group->painterPath.toSubpathPolygons();
 
-                for (int i = 0; i < points.size() - 1; i++) {
+                // Segments to test, all of them unless the series is sorted by x. Sortedness
+                // is followed as the points change, so checking it doesn't scan the points.
+                qsizetype firstSegment = 0;
+                qsizetype endSegment = pathPointCount - 1;
+                if (group->series->d_func()->isSortedByX()) {
+                    // Path x coordinates are monotonic, decreasing when the axis is flipped.
+                    // Find the segments that can be within hover distance of the cursor.
+                    // Each spline point is the third element of its cubicTo.
+                    const auto &path = group->painterPath;
+                    auto elementX = [&path, isLine](qsizetype pathIndex) {
+                        return path.elementAt(isLine ? pathIndex : pathIndex * 3).x;
+                    };
+                    const qreal direction = elementX(pathPointCount - 1) < elementX(0) ? -1 : 1;
+                    const qreal margin = 2 * hoverSize;
+                    auto partitionPoint = [&](auto predicate) {
+                        qsizetype low = 0;
+                        qsizetype high = pathPointCount;
+                        while (low < high) {
+                            const qsizetype middle = low + (high - low) / 2;
+                            if (predicate(direction * elementX(middle)))
+                                low = middle + 1;
+                            else
+                                high = middle;
+                        }
+                        return low;
+                    };
+                    const qreal x = direction * x0;
+                    firstSegment = partitionPoint([&](qreal ex) { return ex < x - margin; }) - 1;
+                    endSegment = partitionPoint([&](qreal ex) { return ex <= x + margin; });
+                    // Curves can bulge past their end points, so also test their neighbors
+                    if (!isLine) {
+                        --firstSegment;
+                        ++endSegment;
+                    }
+                    firstSegment = qMax(qsizetype(0), firstSegment);
+                    endSegment = qMin(pathPointCount - 1, endSegment);
+                }
+
+                for (qsizetype i = firstSegment; i < endSegment; i++) {
                     qreal x1, y1, x2, y2;
                     if (i == 0) {
                         auto element1 = group->painterPath.elementAt(0);
@@ -634,8 +1398,8 @@ bool PointRenderer::handleHoverMove(QHoverEvent *event)
                         // [1] : 1. LineToElement (x, y)
                         // [2] : 2. LineToElement (x, y)
                         // ...
-                        int element1Index = n ? (i + 1) : i;
-                        int element2Index = n ? i : (i + 1);
+                        qsizetype element1Index = n ? (i + 1) : i;
+                        qsizetype element2Index = n ? i : (i + 1);
                         element1Index = isLine ? element1Index : element1Index * 3;
                         element2Index = isLine ? element2Index : element2Index * 3;
                         auto element1 = group->painterPath.elementAt(element1Index);
@@ -669,8 +1433,8 @@ bool PointRenderer::handleHoverMove(QHoverEvent *event)
                             if (alpha >= -extrapolation && alpha <= 1.0 + extrapolation) {
                                 bool n = isVNegative | isHNegative;
 
-                                const QPointF &point1 = points[n ? i + 1 : i];
-                                const QPointF &point2 = points[n ? i : i + 1];
+                                const QPointF &point1 = points[pointIndex(n ? i + 1 : i)];
+                                const QPointF &point2 = points[pointIndex(n ? i : i + 1)];
 
                                 QPointF point = (point2 * (1.0 - alpha)) + (point1 * alpha);
 
@@ -685,12 +1449,21 @@ bool PointRenderer::handleHoverMove(QHoverEvent *event)
                             }
                         }
                     } else { // Spline
-                        auto segments = subpath[0];
-
-                        for (auto it = segments.begin(); it != segments.end(); ++it) {
-                            if (std::next(it, 1) == segments.end())
-                                break;
-
+                        // Only the flattened part of this segment is tested, and only when the
+                        // cursor is near its bounds
+                        const QRectF bounds = group->splineSegmentBounds.at(i).adjusted(-hoverSize,
+                                                                                        -hoverSize,
+                                                                                        hoverSize,
+                                                                                        hoverSize);
+                        if (!bounds.contains(position))
+                            continue;
+
+                        const auto &polyline = group->splinePolyline;
+                        const auto segmentEnd = polyline.cbegin()
+                                                + group->splineSegmentStarts.at(i + 1);
+                        for (auto it = polyline.cbegin() + group->splineSegmentStarts.at(i);
+                             it != segmentEnd;
+                             ++it) {
                             auto it2 = std::next(it, 1);
 
                             qreal denominator = (it2->x() - it->x()) * (it2->x() - it->x())
@@ -16,9 +16,17 @@
 
 #include <QQuickItem>
 #include <QtGraphs/qabstractseries.h>
+#include <QtGraphs/qxyseries.h>
 #include <QtQuick/private/qsgdefaultinternalrectanglenode_p.h>
 #include <QtQuickShapes/private/qquickshape_p.h>
 #include <QPainterPath>
+#include <QPolygonF>
+#include <QtCore/QHash>
+#include <QtCore/QSet>
+#include <QtGui/QTransform>
+#include <QtQuick/QSGGeometry>
+#include <private/coloredgeometry_p.h>
+#include <private/hittestgrid_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -28,6 +36,7 @@ class QLineSeries;
 class QScatterSeries;
 class QSplineSeries;
 class AxisRenderer;
+class QGraphsTheme;
 struct QLegendData;
 
 class PointRenderer : public QQuickItem
@@ -46,26 +55,131 @@ public:
     bool handleMouseRelease(QMouseEvent *event);
     bool handleHoverMove(QHoverEvent *event);
 
+protected:
+    QSGNode *updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *updatePaintNodeData) override;
+
 private:
+    friend class tst_scatter;
+    friend class tst_bench_xyseries2d;
+
     struct PointGroup
     {
         QXYSeries *series = nullptr;
         QQuickShapePath *shapePath = nullptr;
         QPainterPath painterPath;
-        QList<QQuickItem *> markers;
+        // Delegates of the points inside the plot area, by point index
+        QHash<qsizetype, QQuickItem *> markers;
+        // Delegates from before a full update, reused for the same points when possible
+        QHash<qsizetype, QQuickItem *> previousMarkers;
+        // Hidden delegates kept for reuse
+        QList<QQuickItem *> markerPool;
+        // Size of the latest delegate, invalid before the first one
+        QSizeF delegateSize;
         QQmlComponent *currentMarker = nullptr;
         QQmlComponent *previousMarker = nullptr;
         QList<QRectF> rects;
+        // Index of the point of the first rect, as only visible points have rects
+        qsizetype rectsOffset = 0;
+        // Spatial index of rects for press and hover lookups
+        HitTestGrid hitGrid;
+        // Indexes of the points the painterPath is built from, empty when it uses all of them
+        QList<qsizetype> pathIndexes;
+        // Spline path flattened for hover tests. Segment i, between path points i and i + 1,
+        // covers splinePolyline[splineSegmentStarts[i]..splineSegmentStarts[i + 1]].
+        QPolygonF splinePolyline;
+        QList<qsizetype> splineSegmentStarts;
+        QList<QRectF> splineSegmentBounds;
         qsizetype colorIndex = -1;
         bool hover = false;
+
+        // Incremental update state. When only points were appended since the previous
+        // polish and the render transform is unchanged, only the new points are processed.
+        QTransform renderTransform;
+        qsizetype renderedCount = 0;
+        qsizetype pendingUpdates = 1;
+        // Number of append notifications, and the number of points they appended
+        qsizetype pendingAppends = 0;
+        qsizetype pendingAppendedPoints = 0;
+        // First point index to process in the current polish, 0 for a full update
+        qsizetype updateFrom = 0;
+        // Points to process in the current polish, [firstVisible, endVisible). When the
+        // series is sorted by x, points outside of the visible x range are skipped.
+        qsizetype firstVisible = 0;
+        qsizetype endVisible = 0;
+
+        // Default markers, drawn from a single geometry node when there is no pointDelegate
+        QSet<qsizetype> selectedMarkers;
+        QColor markerColor;
+        QColor markerSelectedColor;
+        QColor markerBorderColor;
+        qreal markerBorderWidth = 0;
+        bool defaultMarkers = false;
+        bool markersDirty = false;
+        // Marker geometry prepared on a worker thread, copied as is into the marker node
+        ColoredVertices markerVertices;
+        QList<quint32> markerIndices;
+
+        // Geometry job running for this group, 0 when there is none. Results of any other
+        // job are dropped. When the series changes while a job is running, a new job is
+        // started once the running one has finished.
+        quint64 geometryJob = 0;
+        bool geometryRerun = false;
+    };
+
+    // Input of a geometry job. The points are a copy of the series points, so the series
+    // can be modified while the job runs.
+    struct GeometrySnapshot
+    {
+        QList<QPointF> points;
+        // Points to build rects for, [first, end)
+        qsizetype first = 0;
+        qsizetype end = 0;
+        // Decimation of the path, which is done by the job. The path is limited to
+        // [visibleLeft, visibleRight] when [first, end) is not all of the points.
+        QXYSeries::DecimationMode decimationMode = QXYSeries::DecimationMode::None;
+        qsizetype decimationTarget = 0;
+        qreal decimationScale = 0;
+        qreal decimationOffset = 0;
+        qreal visibleLeft = 0;
+        qreal visibleRight = 0;
+        QTransform transform;
+        QSizeF area;
+        qreal markerSize = 0;
+        bool buildPath = false;
+        bool buildMarkers = false;
+        QSet<qsizetype> selectedMarkers;
+        QColor markerColor;
+        QColor markerSelectedColor;
+        QColor markerBorderColor;
+        qreal markerBorderWidth = 0;
     };
 
-    QQmlComponent *m_tempMarker = nullptr;
+    struct GeometryResult
+    {
+        QList<QRectF> rects;
+        qsizetype rectsOffset = 0;
+        HitTestGrid hitGrid;
+        QPainterPath painterPath;
+        QList<qsizetype> pathIndexes;
+        ColoredVertices markerVertices;
+        QList<quint32> markerIndices;
+    };
+
+    // Series with at least this many points and no pointDelegate have their geometry
+    // prepared on a worker thread
+    static constexpr qsizetype AsyncGeometryThreshold = 10000;
 
     QGraphsView *m_graph = nullptr;
     QQuickShape m_shape;
     QMap<QXYSeries *, PointGroup *> m_groups;
+    ColoredGeometryNodes m_markerNodes{ ColoredGeometryNodes::Indices::UnsignedInt };
     qsizetype m_currentColorIndex = 0;
+    quint64 m_lastGeometryJob = 0;
+    // Points of the series being updated mapped to render coordinates, reused between polishes
+    QList<QPointF> m_mappedPoints;
+    QGraphsTheme *m_theme = nullptr;
+    QMetaObject::Connection m_themeConnection;
+    bool m_themeChanged = false;
 
     // Point drag variables
     bool m_pointPressed = false;
@@ -84,13 +198,29 @@ private:
 
     qreal defaultSize(QXYSeries *series = nullptr);
 
+    QTransform renderTransform(AxisRenderer *axisRenderer) const;
+    bool visibleXRange(QXYSeries *series, PointGroup *group, qreal *left, qreal *right);
+    void prepareUpdate(QXYSeries *series, PointGroup *group);
+
     void calculateRenderCoordinates(
         AxisRenderer *axisRenderer, qreal origX, qreal origY, qreal *renderX, qreal *renderY);
     void reverseRenderCoordinates(
         AxisRenderer *axisRenderer, qreal renderX, qreal renderY, qreal *origX, qreal *origY);
     void updatePointDelegate(
         QXYSeries *series, PointGroup *group, qsizetype pointIndex, qreal x, qreal y);
+    void beginPointDelegates(PointGroup *group);
+    void endPointDelegates(PointGroup *group);
+    QQuickItem *takePointDelegate(PointGroup *group, qsizetype pointIndex);
+    void releasePointDelegate(PointGroup *group, QQuickItem *marker);
+    void deletePointDelegates(PointGroup *group);
     void hidePointDelegates(QXYSeries *series);
+    void updateMarkerStyle(QXYSeries *series, PointGroup *group);
+    void updateDefaultMarkers(QXYSeries *series, PointGroup *group);
+    bool useGeometryJob(QXYSeries *series, PointGroup *group) const;
+    void startGeometryJob(QXYSeries *series, PointGroup *group, GeometrySnapshot &&snapshot);
+    void applyGeometryJob(QXYSeries *series, quint64 job, GeometryResult &&result);
+    static GeometryResult prepareGeometry(const GeometrySnapshot &snapshot);
+    void updateMarkerNode(QSGNode *root, QXYSeries *series, PointGroup *group);
     void updateLegendData(QXYSeries *series, QLegendData &legendData);
 
 #ifdef USE_SCATTERGRAPH
@@ -5,6 +5,7 @@
 #include <private/qgraphsview_p.h>
 #include <private/qsplineseries_p.h>
 #include <private/qxypoint_p.h>
+#include <QtCore/qvarlengtharray.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -80,20 +81,39 @@ void QSplineSeries::componentComplete()
     if (d->m_graphTransition)
         d->m_graphTransition->initialize();
 
-    connect(this, &QSplineSeries::pointAdded, this, [d]([[maybe_unused]] int index) {
-        d->calculateSplinePoints();
+    connect(this, &QSplineSeries::pointAdded, this, [this, d](qsizetype index) {
+        if (index == count() - 1)
+            d->updateSplinePoints(index, true);
+        else
+            d->calculateSplinePoints();
     });
 
     connect(this, &QSplineSeries::pointRemoved, this, [d]([[maybe_unused]] int index) {
         d->calculateSplinePoints();
     });
 
-    connect(this, &QSplineSeries::pointReplaced, this, [d]([[maybe_unused]] int index) {
-        d->calculateSplinePoints();
+    connect(this, &QSplineSeries::pointReplaced, this, [d](qsizetype index) {
+        d->updateSplinePoints(index, false);
     });
 
     connect(this, &QSplineSeries::pointsReplaced, this, [d]() { d->calculateSplinePoints(); });
 
+    connect(this, &QSplineSeries::pointsAdded, this, [d]() { d->calculateSplinePoints(); });
+
+    connect(this, &QSplineSeries::pointRangeReplaced, this, [d]() { d->calculateSplinePoints(); });
+
+    connect(this, &QSplineSeries::pointsRemoved, this, [d]() { d->calculateSplinePoints(); });
+
+    connect(this, &QSplineSeries::windowAdvanced, this, [d]() { d->calculateSplinePoints(); });
+
+    connect(this, &QSplineSeries::decimationModeChanged, this, [d]() {
+        d->calculateSplinePoints();
+    });
+
+    connect(this, &QSplineSeries::decimationTargetChanged, this, [d]() {
+        d->calculateSplinePoints();
+    });
+
     QAbstractSeries::componentComplete();
 }
 
@@ -105,6 +125,14 @@ QAbstractSeries::SeriesType QSplineSeries::type() const
 QList<QPointF> &QSplineSeries::getControlPoints()
 {
     Q_D(QSplineSeries);
+    // The points may have changed without a signal, for example while signals were blocked.
+    // During a transition the control point animation owns the control points, as long
+    // as there are enough of them for the points.
+    if (d->m_controlPointsRevision != d->m_pointsRevision
+        && (!d->m_graphTransition
+            || d->m_controlPoints.size() != d->controlPointCount())) {
+        d->calculateSplinePoints();
+    }
     return d->m_controlPoints;
 }
 
@@ -153,25 +181,35 @@ QSplineSeriesPrivate::QSplineSeriesPrivate()
 
 void QSplineSeriesPrivate::calculateSplinePoints()
 {
-    if (m_points.size() == 0) {
+    // With decimation the spline is fitted through the reduced set of points only
+    const QList<qsizetype> &indexes = decimatedIndexes(0, 0);
+    QList<QPointF> decimatedPoints;
+    decimatedPoints.reserve(indexes.size());
+    for (qsizetype index : indexes)
+        decimatedPoints.append(m_points.at(index));
+    const QList<QPointF> &points = indexes.isEmpty() ? m_points : decimatedPoints;
+
+    m_controlPointsRevision = m_pointsRevision;
+
+    if (points.size() == 0) {
         m_controlPoints.clear();
         return;
-    } else if (m_points.size() == 1) {
-        m_controlPoints = {m_points[0], m_points[0]};
+    } else if (points.size() == 1) {
+        m_controlPoints = {points[0], points[0]};
         return;
     }
 
     QList<QPointF> controlPoints;
-    controlPoints.resize(m_points.size() * 2 - 2);
+    controlPoints.resize(points.size() * 2 - 2);
 
-    qsizetype n = m_points.size() - 1;
+    qsizetype n = points.size() - 1;
 
     if (n == 1) {
         //for n==1
-        controlPoints[0].setX((2 * m_points[0].x() + m_points[1].x()) / 3);
-        controlPoints[0].setY((2 * m_points[0].y() + m_points[1].y()) / 3);
-        controlPoints[1].setX(2 * controlPoints[0].x() - m_points[0].x());
-        controlPoints[1].setY(2 * controlPoints[0].y() - m_points[0].y());
+        controlPoints[0].setX((2 * points[0].x() + points[1].x()) / 3);
+        controlPoints[0].setY((2 * points[0].y() + points[1].y()) / 3);
+        controlPoints[1].setX(2 * controlPoints[0].x() - points[0].x());
+        controlPoints[1].setY(2 * controlPoints[0].y() - points[0].y());
         m_controlPoints = controlPoints;
     }
 
@@ -190,21 +228,21 @@ void QSplineSeriesPrivate::calculateSplinePoints()
     QList<qreal> list;
     list.resize(n);
 
-    list[0] = m_points[0].x() + 2 * m_points[1].x();
+    list[0] = points[0].x() + 2 * points[1].x();
 
     for (int i = 1; i < n - 1; ++i)
-        list[i] = 4 * m_points[i].x() + 2 * m_points[i + 1].x();
+        list[i] = 4 * points[i].x() + 2 * points[i + 1].x();
 
-    list[n - 1] = (8 * m_points[n - 1].x() + m_points[n].x()) / 2.0;
+    list[n - 1] = (8 * points[n - 1].x() + points[n].x()) / 2.0;
 
     const QList<qreal> xControl = calculateControlPoints(list);
 
-    list[0] = m_points[0].y() + 2 * m_points[1].y();
+    list[0] = points[0].y() + 2 * points[1].y();
 
     for (int i = 1; i < n - 1; ++i)
-        list[i] = 4 * m_points[i].y() + 2 * m_points[i + 1].y();
+        list[i] = 4 * points[i].y() + 2 * points[i + 1].y();
 
-    list[n - 1] = (8 * m_points[n - 1].y() + m_points[n].y()) / 2.0;
+    list[n - 1] = (8 * points[n - 1].y() + points[n].y()) / 2.0;
 
     const QList<qreal> yControl = calculateControlPoints(list);
 
@@ -215,17 +253,136 @@ void QSplineSeriesPrivate::calculateSplinePoints()
         j++;
 
         if (i < n - 1) {
-            controlPoints[j].setX(2 * m_points[i + 1].x() - xControl[i + 1]);
-            controlPoints[j].setY(2 * m_points[i + 1].y() - yControl[i + 1]);
+            controlPoints[j].setX(2 * points[i + 1].x() - xControl[i + 1]);
+            controlPoints[j].setY(2 * points[i + 1].y() - yControl[i + 1]);
         } else {
-            controlPoints[j].setX((m_points[n].x() + xControl[n - 1]) / 2);
-            controlPoints[j].setY((m_points[n].y() + yControl[n - 1]) / 2);
+            controlPoints[j].setX((points[n].x() + xControl[n - 1]) / 2);
+            controlPoints[j].setY((points[n].y() + yControl[n - 1]) / 2);
         }
     }
 
     m_controlPoints = controlPoints;
 }
 
+// Number of control points calculateSplinePoints() gives for the current points
+qsizetype QSplineSeriesPrivate::controlPointCount()
+{
+    const qsizetype indexCount = decimatedIndexes(0, 0).size();
+    const qsizetype count = indexCount > 0 ? indexCount : m_points.size();
+    return count > 1 ? 2 * count - 2 : 2 * count;
+}
+
+// Updates the control points after the point at index was appended or replaced.
+// Only the equations within IncrementalSolveWindow of the change are re-solved,
+// and the previous solution is kept outside of that window. Falls back to
+// calculateSplinePoints() when the previous solution is not for the points before
+// this change, or when the change does not decay enough within the window.
+void QSplineSeriesPrivate::updateSplinePoints(qsizetype index, bool appended)
+{
+    // Number of segments, which is also the number of equations
+    const qsizetype n = m_points.size() - 1;
+    const qsizetype previousSegments = appended ? n - 1 : n;
+
+    const bool incremental = m_decimationMode == QXYSeries::DecimationMode::None
+                             && !m_graphTransition
+                             && m_pointsRevision == m_controlPointsRevision + 1
+                             && m_controlPoints.size() == 2 * previousSegments
+                             && n > 2 * IncrementalSolveWindow;
+    if (!incremental) {
+        calculateSplinePoints();
+        return;
+    }
+
+    qsizetype first;
+    qsizetype last;
+    if (appended) {
+        m_controlPoints.resize(2 * n);
+        first = n - IncrementalSolveWindow;
+        last = n - 1;
+    } else {
+        // Replacing point i changes the right-hand sides of equations i - 1 and i
+        first = qMax(0, index - 1 - IncrementalSolveWindow);
+        last = qMin(n - 1, index + IncrementalSolveWindow);
+    }
+
+    if (!solveControlPointWindow(first, last)) {
+        calculateSplinePoints();
+        return;
+    }
+
+    m_controlPointsRevision = m_pointsRevision;
+}
+
+// Solves equations first..last of the system described in calculateSplinePoints(),
+// using the current first control points just outside of the range as known values.
+// The results are written to m_controlPoints only if the change at both ends of the
+// range is small enough to be ignored beyond it.
+bool QSplineSeriesPrivate::solveControlPointWindow(qsizetype first, qsizetype last)
+{
+    const qsizetype n = m_points.size() - 1;
+    const qsizetype size = last - first + 1;
+    const QPointF *p = m_points.constData();
+
+    QVarLengthArray<QPointF, 2 * IncrementalSolveWindow + 2> rhs(size);
+    QVarLengthArray<qreal, 2 * IncrementalSolveWindow + 2> diagonal(size);
+
+    for (qsizetype i = first; i <= last; ++i) {
+        if (i == 0) {
+            rhs[i - first] = p[0] + 2 * p[1];
+            diagonal[i - first] = 2.0;
+        } else if (i == n - 1) {
+            rhs[i - first] = (8 * p[n - 1] + p[n]) / 2.0;
+            diagonal[i - first] = 3.5;
+        } else {
+            rhs[i - first] = 4 * p[i] + 2 * p[i + 1];
+            diagonal[i - first] = 4.0;
+        }
+    }
+    if (first > 0)
+        rhs[0] -= m_controlPoints.at(2 * (first - 1));
+    if (last < n - 1)
+        rhs[size - 1] -= m_controlPoints.at(2 * (last + 1));
+
+    // Thomas algorithm, all off-diagonal coefficients are 1
+    QVarLengthArray<qreal, 2 * IncrementalSolveWindow + 2> temp(size);
+    qreal b = diagonal[0];
+    temp[0] = 0;
+    rhs[0] /= b;
+    for (qsizetype i = 1; i < size; ++i) {
+        temp[i] = 1 / b;
+        b = diagonal[i] - temp[i];
+        rhs[i] = (rhs[i] - rhs[i - 1]) / b;
+    }
+    for (qsizetype i = size - 2; i >= 0; --i)
+        rhs[i] -= temp[i + 1] * rhs[i + 1];
+
+    // The solution changes by a factor of about 2 - sqrt(3) per equation, so the change
+    // at an end of the window estimates the error of keeping the value next to it
+    auto withinBound = [&](qsizetype i) {
+        const QPointF previous = m_controlPoints.at(2 * i);
+        const QPointF change = rhs[i - first] - previous;
+        const qreal scale = qMax(1.0, qMax(qAbs(previous.x()), qAbs(previous.y())));
+        return (qAbs(change.x()) + qAbs(change.y())) * 0.27 <= scale * 1e-9;
+    };
+    if (first > 0 && !withinBound(first))
+        return false;
+    // For appended points the last equation is new and its previous value does not exist
+    if (last < n - 1 && !withinBound(last))
+        return false;
+
+    for (qsizetype i = first; i <= last; ++i)
+        m_controlPoints[2 * i] = rhs[i - first];
+
+    for (qsizetype i = qMax(0, first - 1); i <= last; ++i) {
+        if (i < n - 1)
+            m_controlPoints[2 * i + 1] = 2 * p[i + 1] - m_controlPoints.at(2 * (i + 1));
+        else
+            m_controlPoints[2 * i + 1] = (p[n] + m_controlPoints.at(2 * (n - 1))) / 2;
+    }
+
+    return true;
+}
+
 QList<qreal> QSplineSeriesPrivate::calculateControlPoints(const QList<qreal> &list)
 {
     QList<qreal> result;
@@ -28,8 +28,17 @@ protected:
     qreal m_width;
     Qt::PenCapStyle m_capStyle;
     QList<QPointF> m_controlPoints;
+    // Value of m_pointsRevision when m_controlPoints was last solved
+    quint64 m_controlPointsRevision = 0;
+
+    // Number of control point equations re-solved on each side of a changed point.
+    // The influence of a change decays by a factor of 2 - sqrt(3) per equation.
+    static constexpr qsizetype IncrementalSolveWindow = 32;
 
     void calculateSplinePoints();
+    qsizetype controlPointCount();
+    void updateSplinePoints(qsizetype index, bool appended);
+    bool solveControlPointWindow(qsizetype first, qsizetype last);
     QList<qreal> calculateControlPoints(const QList<qreal> &list);
 
 private:
@@ -328,6 +328,18 @@ void QXYModelMapper::setSeries(QXYSeries *series)
                                    &QXYSeries::pointsRemoved,
                                    d,
                                    &QXYModelMapperPrivate::onPointsRemoved);
+        QObjectPrivate::disconnect(d->m_series,
+                                   &QXYSeries::windowAdvanced,
+                                   d,
+                                   &QXYModelMapperPrivate::onWindowAdvanced);
+        QObjectPrivate::disconnect(d->m_series,
+                                   &QXYSeries::pointsAdded,
+                                   d,
+                                   &QXYModelMapperPrivate::onPointsAdded);
+        QObjectPrivate::disconnect(d->m_series,
+                                   &QXYSeries::pointRangeReplaced,
+                                   d,
+                                   &QXYModelMapperPrivate::onPointRangeReplaced);
     }
 
     if (series == 0)
@@ -356,6 +368,18 @@ void QXYModelMapper::setSeries(QXYSeries *series)
                             &QXYSeries::pointsRemoved,
                             d,
                             &QXYModelMapperPrivate::onPointsRemoved);
+    QObjectPrivate::connect(d->m_series,
+                            &QXYSeries::windowAdvanced,
+                            d,
+                            &QXYModelMapperPrivate::onWindowAdvanced);
+    QObjectPrivate::connect(d->m_series,
+                            &QXYSeries::pointsAdded,
+                            d,
+                            &QXYModelMapperPrivate::onPointsAdded);
+    QObjectPrivate::connect(d->m_series,
+                            &QXYSeries::pointRangeReplaced,
+                            d,
+                            &QXYModelMapperPrivate::onPointRangeReplaced);
     Q_EMIT seriesChanged();
 }
 
@@ -559,6 +583,72 @@ void QXYModelMapperPrivate::onPointReplaced(qsizetype pointIndex)
     blockModelSignals(false);
 }
 
+void QXYModelMapperPrivate::onPointsAdded(qsizetype pointIndex, qsizetype count)
+{
+    if (m_seriesSignalsBlock)
+        return;
+
+    if (m_count != -1)
+        m_count += count;
+
+    blockModelSignals();
+    if (m_orientation == Qt::Vertical)
+        m_model->insertRows(int(pointIndex) + m_first, int(count));
+    else
+        m_model->insertColumns(int(pointIndex) + m_first, int(count));
+
+    const QList<QPointF> points = m_series->points();
+    for (qsizetype i = pointIndex; i < pointIndex + count; ++i) {
+        setValueToModel(xModelIndex(i), points.at(i).x());
+        setValueToModel(yModelIndex(i), points.at(i).y());
+    }
+    blockModelSignals(false);
+}
+
+void QXYModelMapperPrivate::onPointRangeReplaced(qsizetype pointIndex, qsizetype count)
+{
+    if (m_seriesSignalsBlock)
+        return;
+
+    blockModelSignals();
+    const QList<QPointF> points = m_series->points();
+    for (qsizetype i = pointIndex; i < pointIndex + count; ++i) {
+        setValueToModel(xModelIndex(i), points.at(i).x());
+        setValueToModel(yModelIndex(i), points.at(i).y());
+    }
+    blockModelSignals(false);
+}
+
+void QXYModelMapperPrivate::onWindowAdvanced(qsizetype removedCount, qsizetype addedCount)
+{
+    if (m_seriesSignalsBlock)
+        return;
+
+    if (m_count != -1)
+        m_count += addedCount - removedCount;
+
+    const qsizetype firstAdded = m_series->count() - addedCount;
+
+    blockModelSignals();
+    if (m_orientation == Qt::Vertical) {
+        if (removedCount > 0)
+            m_model->removeRows(m_first, int(removedCount));
+        if (addedCount > 0)
+            m_model->insertRows(int(firstAdded) + m_first, int(addedCount));
+    } else {
+        if (removedCount > 0)
+            m_model->removeColumns(m_first, int(removedCount));
+        if (addedCount > 0)
+            m_model->insertColumns(int(firstAdded) + m_first, int(addedCount));
+    }
+
+    for (qsizetype i = firstAdded; i < m_series->count(); ++i) {
+        setValueToModel(xModelIndex(i), m_series->points().at(i).x());
+        setValueToModel(yModelIndex(i), m_series->points().at(i).y());
+    }
+    blockModelSignals(false);
+}
+
 void QXYModelMapperPrivate::handleSeriesDestroyed()
 {
     m_series = 0;
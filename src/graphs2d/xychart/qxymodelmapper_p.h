@@ -38,6 +38,9 @@ public Q_SLOTS:
     void onPointRemoved(qsizetype pointIndex);
     void onPointsRemoved(qsizetype pointIndex, qsizetype count);
     void onPointReplaced(qsizetype pointIndex);
+    void onPointsAdded(qsizetype pointIndex, qsizetype count);
+    void onPointRangeReplaced(qsizetype pointIndex, qsizetype count);
+    void onWindowAdvanced(qsizetype removedCount, qsizetype addedCount);
     void handleSeriesDestroyed();
 
     void initializeXYFromModel();
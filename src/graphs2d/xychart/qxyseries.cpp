@@ -4,6 +4,10 @@
 #include <QtGraphs/qxyseries.h>
 #include <private/qxyseries_p.h>
 #include <private/charthelpers_p.h>
+#include <QtCore/qmath.h>
+
+#include <algorithm>
+#include <functional>
 
 QT_BEGIN_NAMESPACE
 
@@ -84,6 +88,12 @@ QXYSeries::QXYSeries(QXYSeriesPrivate &dd, QObject *parent)
     QObject::connect(this, &QXYSeries::pointsReplaced, this, &QAbstractSeries::update);
     QObject::connect(this, &QXYSeries::pointRemoved, this, &QAbstractSeries::update);
     QObject::connect(this, &QXYSeries::pointsRemoved, this, &QAbstractSeries::update);
+    QObject::connect(this, &QXYSeries::decimationModeChanged, this, &QAbstractSeries::update);
+    QObject::connect(this, &QXYSeries::decimationTargetChanged, this, &QAbstractSeries::update);
+    QObject::connect(this, &QXYSeries::pointDelegateLimitChanged, this, &QAbstractSeries::update);
+    QObject::connect(this, &QXYSeries::windowAdvanced, this, &QAbstractSeries::update);
+    QObject::connect(this, &QXYSeries::pointsAdded, this, &QAbstractSeries::update);
+    QObject::connect(this, &QXYSeries::pointRangeReplaced, this, &QAbstractSeries::update);
 }
 
 /*!
@@ -110,7 +120,9 @@ void QXYSeries::append(QPointF point)
     Q_D(QXYSeries);
 
     if (isValidValue(point)) {
-        if (d->m_graphTransition && d->m_graphTransition->initialized()
+        if (d->m_capacity > 0 && d->m_points.size() >= d->m_capacity) {
+            d->appendToWindow(QSpan<const QPointF>(&point, 1));
+        } else if (d->m_graphTransition && d->m_graphTransition->initialized()
             && d->m_graphTransition->contains(QGraphAnimation::GraphAnimationType::GraphPoint)) {
             d->m_graphTransition->stop();
             d->m_graphTransition->onPointChanged(QGraphTransition::TransitionType::PointAdded,
@@ -118,6 +130,7 @@ void QXYSeries::append(QPointF point)
                                                  point);
         } else {
             d->m_points << point;
+            d->markPointsAppended(1);
             emit pointAdded(d->m_points.size() - 1);
             emit countChanged();
         }
@@ -126,15 +139,24 @@ void QXYSeries::append(QPointF point)
 
 /*!
     \qmlmethod XYSeries::append(list<point> points)
-    Appends points with the coordinates \a points to the series.
+    Appends points with the coordinates \a points to the series, and emits
+    \l pointsAdded and \l countChanged once for the whole list. The points are
+    added without animation. If this exceeds \l capacity, the oldest points are
+    removed and a single \l windowAdvanced signal is emitted instead.
 */
 /*!
-    Appends points with the coordinates \a points to the series.
+    Appends points with the coordinates \a points to the series, and emits
+    pointsAdded() and countChanged() once for the whole list. The points are
+    added without animation. If this exceeds \l capacity, the oldest points are
+    removed and a single windowAdvanced() signal is emitted instead.
+
+    \sa appendRange()
 */
 void QXYSeries::append(const QList<QPointF> &points)
 {
-    for (const QPointF &point : points)
-        append(point);
+    Q_D(QXYSeries);
+    d->finishTransition();
+    d->insertPoints(d->m_points.size(), points);
 }
 
 /*!
@@ -212,6 +234,7 @@ void QXYSeries::replace(qsizetype index, QPointF newPoint)
                                                  newPoint);
         } else {
             d->m_points[index] = newPoint;
+            d->markPointsReplaced(index, 1);
             emit pointReplaced(index);
         }
     }
@@ -235,9 +258,11 @@ void QXYSeries::replace(const QList<QPointF> &points)
     Q_D(QXYSeries);
     bool hasDifferentSize = d->m_points.size() != points.size();
     d->m_points = points;
+    d->markPointsChanged();
     emit pointsReplaced();
     if (hasDifferentSize)
         emit countChanged();
+    d->trimToCapacity();
 }
 
 /*!
@@ -294,6 +319,7 @@ void QXYSeries::remove(qsizetype index)
                                              {});
     } else {
         d->m_points.remove(index);
+        d->markPointsRemoved(index, 1);
         bool callSignal = false;
         d->setPointSelected(index, false, callSignal);
 
@@ -307,11 +333,13 @@ void QXYSeries::remove(qsizetype index)
 /*!
     \qmlmethod XYSeries::removeMultiple(int index, int count)
     Removes the number of points specified by \a count from the series starting
-    at the position specified by \a index.
+    at the position specified by \a index, and emits \l pointsRemoved once.
+    Does nothing if the range does not fit in the series.
 */
 /*!
     Removes the number of points specified by \a count from the series starting
-    at the position specified by \a index.
+    at the position specified by \a index, and emits pointsRemoved() once.
+    Does nothing if the range does not fit in the series.
 */
 void QXYSeries::removeMultiple(qsizetype index, qsizetype count)
 {
@@ -319,35 +347,36 @@ void QXYSeries::removeMultiple(qsizetype index, qsizetype count)
     // remove(qreal, qreal) overload in some implicit casting cases.
     Q_D(QXYSeries);
 
+    d->finishTransition();
+
     if (index < 0 || count < 1 || index + count > d->m_points.size())
         return;
 
-    if (count > 0) {
-        d->m_points.remove(index, count);
+    d->m_points.remove(index, count);
+    d->markPointsRemoved(index, count);
 
-        bool callSignal = false;
-        if (!d->m_selectedPoints.empty()) {
-            QSet<qsizetype> selectedAfterRemoving;
-
-            for (const qsizetype &selectedPointIndex : std::as_const(d->m_selectedPoints)) {
-                if (selectedPointIndex < index) {
-                    selectedAfterRemoving << selectedPointIndex;
-                } else if (selectedPointIndex >= index + count) {
-                    selectedAfterRemoving << selectedPointIndex - int(count);
-                    callSignal = true;
-                } else {
-                    callSignal = true;
-                }
+    bool callSignal = false;
+    if (!d->m_selectedPoints.empty()) {
+        QSet<qsizetype> selectedAfterRemoving;
+
+        for (const qsizetype &selectedPointIndex : std::as_const(d->m_selectedPoints)) {
+            if (selectedPointIndex < index) {
+                selectedAfterRemoving << selectedPointIndex;
+            } else if (selectedPointIndex >= index + count) {
+                selectedAfterRemoving << selectedPointIndex - count;
+                callSignal = true;
+            } else {
+                callSignal = true;
             }
-
-            d->m_selectedPoints = selectedAfterRemoving;
         }
 
-        emit pointsRemoved(index, count);
-        emit countChanged();
-        if (callSignal)
-            emit selectedPointsChanged();
+        d->m_selectedPoints = selectedAfterRemoving;
     }
+
+    emit pointsRemoved(index, count);
+    emit countChanged();
+    if (callSignal)
+        emit selectedPointsChanged();
 }
 
 /*!
@@ -366,6 +395,7 @@ bool QXYSeries::take(QPointF point)
     for (int i = 0; i < d->m_points.size(); ++i) {
         if (d->m_points[i] == point) {
             d->m_points.removeAt(i);
+            d->markPointsRemoved(i, 1);
             return true;
         }
     }
@@ -396,6 +426,10 @@ void QXYSeries::insert(qsizetype index, QPointF point)
         index = qMax(0, qMin(index, d->m_points.size()));
 
         d->m_points.insert(index, point);
+        if (index == d->m_points.size() - 1)
+            d->markPointsAppended(1);
+        else
+            d->markPointsChanged();
 
         bool callSignal = false;
         if (!d->m_selectedPoints.isEmpty()) {
@@ -415,6 +449,7 @@ void QXYSeries::insert(qsizetype index, QPointF point)
         emit pointAdded(index);
         if (callSignal)
             emit selectedPointsChanged();
+        d->trimToCapacity();
     }
 }
 
@@ -431,6 +466,98 @@ void QXYSeries::clear()
     removeMultiple(0, d->m_points.size());
 }
 
+/*!
+    \qmlmethod XYSeries::appendRange(list<point> points)
+    \since 6.9
+    Appends \a points to the series with a single storage operation.
+
+    Unlike appending the points one by one, this emits \l pointsAdded and
+    \l countChanged once for the whole range. Invalid points are skipped. If this
+    exceeds \l capacity, the oldest points are removed and \l windowAdvanced is
+    emitted instead of \l pointsAdded.
+*/
+/*!
+    \since 6.9
+    Appends \a points to the series with a single storage operation.
+
+    Unlike appending the points one by one, this emits pointsAdded() and
+    countChanged() once for the whole range. Invalid points are skipped. If this
+    exceeds \l capacity, the oldest points are removed and windowAdvanced() is
+    emitted instead of pointsAdded().
+
+    \note Prefer this to appending points one by one when adding many points, for
+    example when loading the history of a data source.
+
+    \sa insertRange(), pointsAdded()
+*/
+void QXYSeries::appendRange(const QList<QPointF> &points)
+{
+    Q_D(QXYSeries);
+    d->finishTransition();
+    d->insertPoints(d->m_points.size(), points);
+}
+
+/*!
+    \qmlmethod XYSeries::insertRange(int index, list<point> points)
+    \since 6.9
+    Inserts \a points to the position specified by \a index with a single
+    storage operation. The index is clamped to the range of the series.
+
+    Emits \l pointsAdded and \l countChanged once for the whole range, and moves
+    the indexes of selected points after \a index. Invalid points are skipped.
+*/
+/*!
+    \since 6.9
+    Inserts \a points to the position specified by \a index with a single
+    storage operation. The index is clamped to the range of the series.
+
+    Emits pointsAdded() and countChanged() once for the whole range, and moves
+    the indexes of selected points after \a index. Invalid points are skipped.
+
+    \sa appendRange(), pointsAdded()
+*/
+void QXYSeries::insertRange(qsizetype index, const QList<QPointF> &points)
+{
+    Q_D(QXYSeries);
+    d->finishTransition();
+    d->insertPoints(qBound<qsizetype>(0, index, d->m_points.size()), points);
+}
+
+/*!
+    \qmlmethod XYSeries::replaceRange(int index, list<point> points)
+    \since 6.9
+    Replaces the points starting at the position specified by \a index with
+    \a points, and emits \l pointRangeReplaced once. Does nothing if the range
+    does not fit in the series. Invalid points leave the old values in place.
+*/
+/*!
+    \since 6.9
+    Replaces the points starting at the position specified by \a index with
+    \a points, and emits pointRangeReplaced() once. Does nothing if the range
+    does not fit in the series. Invalid points leave the old values in place.
+
+    \sa replace(), pointRangeReplaced()
+*/
+void QXYSeries::replaceRange(qsizetype index, const QList<QPointF> &points)
+{
+    Q_D(QXYSeries);
+
+    d->finishTransition();
+
+    if (index < 0 || points.isEmpty() || index + points.size() > d->m_points.size())
+        return;
+
+    QPointF *target = d->m_points.data() + index;
+    for (const QPointF &point : points) {
+        if (isValidValue(point))
+            *target = point;
+        ++target;
+    }
+    d->markPointsReplaced(index, points.size());
+
+    emit pointRangeReplaced(index, points.size());
+}
+
 /*!
     \qmlmethod bool XYSeries::isPointSelected(int index)
     Returns true if point at given \a index is among selected points and false otherwise.
@@ -660,6 +787,22 @@ QList<QPointF> QXYSeries::points() const
     return d->m_points;
 }
 
+/*!
+    \since 6.9
+    Returns a read-only view of the points in the series, without copying them
+    or touching the reference count of the point list.
+
+    The view is only valid until the series is next modified, so it should not be
+    stored. Use points() to keep the points.
+
+    \sa points()
+*/
+QSpan<const QPointF> QXYSeries::pointsSpan() const
+{
+    Q_D(const QXYSeries);
+    return d->m_points;
+}
+
 /*!
     \qmlmethod point XYSeries::at(int index)
     Returns the point at the position specified by \a index. Returns (0, 0) if
@@ -892,6 +1035,272 @@ void QXYSeries::setDraggable(bool newDraggable)
     emit draggableChanged();
 }
 
+/*!
+    \enum QXYSeries::DecimationMode
+    \since 6.9
+
+    This enum describes how the points of a series are reduced before the
+    series is drawn. Decimation only affects drawing, the points of the series
+    and their indexes stay unchanged.
+
+    \value None
+            Every point is drawn.
+    \value PixelMinMax
+            For each horizontal pixel column of the plot area only the first, the
+            last, the minimum, and the maximum point are drawn. The result looks the
+            same as drawing every point, but the drawn path size depends on the plot
+            width instead of the point count. Applies to QLineSeries.
+    \value LargestTriangleThreeBuckets
+            The points are reduced to \l decimationTarget points with the
+            Largest-Triangle-Three-Buckets algorithm, which keeps the visual shape of the
+            series. Applies to QLineSeries and QSplineSeries, also when they are used as
+            the upper or lower series of a QAreaSeries.
+*/
+
+/*!
+    \property QXYSeries::decimationMode
+    \since 6.9
+    \brief The decimation mode used when drawing the series.
+
+    Hovering and selection always refer to the indexes of the original points.
+    By default, \a decimationMode is set to \c{QXYSeries::DecimationMode::None}.
+*/
+/*!
+    \qmlproperty enumeration XYSeries::decimationMode
+    \since 6.9
+    The decimation mode used when drawing the series.
+
+    \value XYSeries.DecimationMode.None
+            Every point is drawn.
+    \value XYSeries.DecimationMode.PixelMinMax
+            For each horizontal pixel column of the plot area only the first, the
+            last, the minimum, and the maximum point are drawn. The result looks the
+            same as drawing every point. Applies to LineSeries.
+    \value XYSeries.DecimationMode.LargestTriangleThreeBuckets
+            The points are reduced to \l decimationTarget points with the
+            Largest-Triangle-Three-Buckets algorithm, which keeps the visual shape of the
+            series. Applies to LineSeries and SplineSeries, also when they are used as
+            the upper or lower series of an AreaSeries.
+
+    Hovering and selection always refer to the indexes of the original points.
+    The default value is \c{XYSeries.DecimationMode.None}.
+*/
+QXYSeries::DecimationMode QXYSeries::decimationMode() const
+{
+    Q_D(const QXYSeries);
+    return d->m_decimationMode;
+}
+
+void QXYSeries::setDecimationMode(DecimationMode mode)
+{
+    Q_D(QXYSeries);
+    if (d->m_decimationMode == mode)
+        return;
+    d->m_decimationMode = mode;
+    d->invalidateDecimation();
+    emit decimationModeChanged();
+}
+
+/*!
+    \property QXYSeries::decimationTarget
+    \since 6.9
+    \brief The number of points the series is reduced to with
+    \c{QXYSeries::DecimationMode::LargestTriangleThreeBuckets}.
+
+    Series with fewer points are not reduced. Values smaller than 3 are
+    ignored. By default, \a decimationTarget is set to \c 1000.
+*/
+/*!
+    \qmlproperty int XYSeries::decimationTarget
+    \since 6.9
+    The number of points the series is reduced to with
+    \c{XYSeries.DecimationMode.LargestTriangleThreeBuckets}.
+
+    Series with fewer points are not reduced. Values smaller than 3 are
+    ignored. The default value is \c 1000.
+*/
+qsizetype QXYSeries::decimationTarget() const
+{
+    Q_D(const QXYSeries);
+    return d->m_decimationTarget;
+}
+
+void QXYSeries::setDecimationTarget(qsizetype target)
+{
+    Q_D(QXYSeries);
+    if (target < 3 || d->m_decimationTarget == target)
+        return;
+    d->m_decimationTarget = target;
+    d->invalidateDecimation();
+    emit decimationTargetChanged();
+}
+
+/*!
+    \property QXYSeries::capacity
+    \since 6.9
+    \brief The maximum number of points in the series.
+
+    When set, the series works as a sliding window. Appending points to a full series
+    removes the same number of the oldest points, and emits a single windowAdvanced()
+    signal instead of pointAdded() and pointRemoved(). Removing the oldest points does not
+    move the remaining ones in memory, so keeping a window of live data costs a constant
+    time per appended point. If the series has more points than the new capacity, the
+    oldest points are removed. Indexes of selected points are shifted accordingly.
+
+    Storage for twice the capacity is reserved. By default, \a capacity is set to \c 0,
+    which means there is no limit.
+*/
+/*!
+    \qmlproperty int XYSeries::capacity
+    \since 6.9
+    The maximum number of points in the series.
+
+    When set, the series works as a sliding window. Appending points to a full series
+    removes the same number of the oldest points, and emits a single \l windowAdvanced
+    signal instead of \l pointAdded and \l pointRemoved. If the series has more points
+    than the new capacity, the oldest points are removed.
+
+    The default value is \c 0, which means there is no limit.
+*/
+qsizetype QXYSeries::capacity() const
+{
+    Q_D(const QXYSeries);
+    return d->m_capacity;
+}
+
+void QXYSeries::setCapacity(qsizetype capacity)
+{
+    Q_D(QXYSeries);
+    capacity = qMax(0, capacity);
+    if (d->m_capacity == capacity)
+        return;
+    d->m_capacity = capacity;
+    emit capacityChanged();
+    d->trimToCapacity();
+}
+
+/*!
+    \property QXYSeries::pointDelegateLimit
+    \since 6.9
+    \brief The maximum number of \l pointDelegate items shown at a time.
+
+    Delegates are only created for the points inside the plot area. Items of points that
+    leave the plot area are hidden and reused for other points, so panning through a long
+    series does not create and destroy items. When more points than the limit are inside
+    the plot area, the points with the lowest indexes get a delegate. Points without a
+    delegate are not shown and can't be hovered or selected.
+
+    By default, \a pointDelegateLimit is set to \c 0, which means there is no limit.
+*/
+/*!
+    \qmlproperty int XYSeries::pointDelegateLimit
+    \since 6.9
+    The maximum number of \l pointDelegate items shown at a time.
+
+    Delegates are only created for the points inside the plot area. Items of points that
+    leave the plot area are hidden and reused for other points. When more points than the
+    limit are inside the plot area, the points with the lowest indexes get a delegate.
+    Points without a delegate are not shown and can't be hovered or selected.
+
+    The default value is \c 0, which means there is no limit.
+*/
+qsizetype QXYSeries::pointDelegateLimit() const
+{
+    Q_D(const QXYSeries);
+    return d->m_pointDelegateLimit;
+}
+
+void QXYSeries::setPointDelegateLimit(qsizetype limit)
+{
+    Q_D(QXYSeries);
+    limit = qMax(0, limit);
+    if (d->m_pointDelegateLimit == limit)
+        return;
+    d->m_pointDelegateLimit = limit;
+    emit pointDelegateLimitChanged();
+}
+
+/*!
+    \fn void QXYSeries::windowAdvanced(qsizetype removedCount, qsizetype addedCount)
+    \since 6.9
+    This signal is emitted once per append operation on a series with a \l capacity,
+    when \a removedCount oldest points were removed from the beginning of the series
+    and \a addedCount points were appended to its end.
+*/
+/*!
+    \qmlsignal XYSeries::windowAdvanced(int removedCount, int addedCount)
+    \since 6.9
+    This signal is emitted once per append operation on a series with a \l capacity,
+    when \a removedCount oldest points were removed from the beginning of the series
+    and \a addedCount points were appended to its end.
+*/
+
+/*!
+    \fn void QXYSeries::pointsAdded(qsizetype index, qsizetype count)
+    \since 6.9
+    This signal is emitted when \a count points were added to the series starting
+    at the position specified by \a index.
+    \sa appendRange(), insertRange()
+*/
+/*!
+    \qmlsignal XYSeries::pointsAdded(int index, int count)
+    \since 6.9
+    This signal is emitted when \a count points were added to the series starting
+    at the position specified by \a index.
+*/
+
+/*!
+    \fn void QXYSeries::pointRangeReplaced(qsizetype index, qsizetype count)
+    \since 6.9
+    This signal is emitted when \a count points were replaced starting at the
+    position specified by \a index.
+    \sa replaceRange()
+*/
+/*!
+    \qmlsignal XYSeries::pointRangeReplaced(int index, int count)
+    \since 6.9
+    This signal is emitted when \a count points were replaced starting at the
+    position specified by \a index.
+*/
+
+/*!
+    \since 6.9
+    Returns the points the series is drawn from when \l decimationMode is set.
+
+    With \c{QXYSeries::DecimationMode::LargestTriangleThreeBuckets} these are the
+    reduced points. With \c{QXYSeries::DecimationMode::PixelMinMax} these are the
+    points of the latest drawn frame, or all points if the series has not been drawn
+    since its points changed. Without decimation all points are returned.
+
+    The reduced set is cached, and it is only recalculated when the points, the
+    decimation settings, or for \c PixelMinMax the axis range or plot size change.
+
+    \sa points(), decimationMode, decimationTarget
+*/
+QList<QPointF> QXYSeries::decimatedPoints() const
+{
+    Q_D(const QXYSeries);
+
+    QList<qsizetype> indexes;
+    if (d->hasValidDecimation()) {
+        indexes = d->m_decimatedIndexes;
+    } else if (d->m_decimationMode == DecimationMode::LargestTriangleThreeBuckets
+               && type() != QAbstractSeries::SeriesType::Scatter) {
+        QXYSeriesPrivate::decimateLargestTriangleThreeBuckets(d->m_points,
+                                                              d->m_decimationTarget,
+                                                              indexes);
+    }
+
+    if (indexes.isEmpty())
+        return d->m_points;
+
+    QList<QPointF> points;
+    points.reserve(indexes.size());
+    for (qsizetype index : std::as_const(indexes))
+        points.append(d->m_points.at(index));
+    return points;
+}
+
 QXYSeries &QXYSeries::operator<<(QPointF point)
 {
     append(point);
@@ -929,4 +1338,341 @@ bool QXYSeriesPrivate::isPointSelected(qsizetype index) const
     return m_selectedPoints.contains(index);
 }
 
+// Inserts points at index with one storage operation, shifting the selection once,
+// and emits a single pointsAdded(). Appends that overflow the capacity go through
+// appendToWindow() instead.
+void QXYSeriesPrivate::insertPoints(qsizetype index, QSpan<const QPointF> points)
+{
+    Q_Q(QXYSeries);
+
+    QList<QPointF> validPoints;
+    // Checked quietly first, isValidValue() warns about each invalid point once below
+    auto isFinite = [](QPointF p) { return qIsFinite(p.x()) && qIsFinite(p.y()); };
+    if (!std::all_of(points.begin(), points.end(), isFinite)) {
+        validPoints.reserve(points.size());
+        for (const QPointF &point : points) {
+            if (isValidValue(point))
+                validPoints.append(point);
+        }
+        points = validPoints;
+    }
+
+    if (points.isEmpty())
+        return;
+
+    // The points may be a view of m_points itself, which is moved below
+    QList<QPointF> copiedPoints;
+    const std::less<const QPointF *> less;
+    if (less(points.data(), m_points.constData() + m_points.size())
+        && less(m_points.constData(), points.data() + points.size())) {
+        copiedPoints.assign(points.begin(), points.end());
+        points = copiedPoints;
+    }
+
+    const qsizetype oldSize = m_points.size();
+    if (m_capacity > 0 && index == oldSize && oldSize + points.size() > m_capacity) {
+        appendToWindow(points);
+        return;
+    }
+
+    m_points.resize(oldSize + points.size());
+    QPointF *data = m_points.data();
+    std::move_backward(data + index, data + oldSize, data + m_points.size());
+    std::copy(points.begin(), points.end(), data + index);
+    if (index == oldSize)
+        markPointsAppended(points.size());
+    else
+        markPointsChanged();
+
+    bool callSignal = false;
+    if (index < oldSize && !m_selectedPoints.isEmpty()) {
+        QSet<qsizetype> selectedAfterInsert;
+        for (const auto &value : std::as_const(m_selectedPoints)) {
+            if (value >= index) {
+                selectedAfterInsert << value + points.size();
+                callSignal = true;
+            } else {
+                selectedAfterInsert << value;
+            }
+        }
+        m_selectedPoints = selectedAfterInsert;
+    }
+
+    emit q->pointsAdded(index, points.size());
+    emit q->countChanged();
+    if (callSignal)
+        emit q->selectedPointsChanged();
+    trimToCapacity();
+}
+
+// Range operations are applied without animation. A running point animation is
+// finished first so that it does not write into the modified list afterwards.
+void QXYSeriesPrivate::finishTransition()
+{
+    if (m_graphTransition && m_graphTransition->initialized()
+        && m_graphTransition->contains(QGraphAnimation::GraphAnimationType::GraphPoint)) {
+        m_graphTransition->stop();
+    }
+}
+
+// Appends points and removes the oldest ones so that at most m_capacity points remain.
+// Removing from the front of a QList only moves its begin pointer, and reserving twice
+// the capacity keeps appends from reallocating, so this is constant time per point.
+void QXYSeriesPrivate::appendToWindow(QSpan<const QPointF> points)
+{
+    Q_Q(QXYSeries);
+
+    if (m_capacity <= 0)
+        return;
+
+    if (points.size() > m_capacity)
+        points = points.last(m_capacity);
+
+    const qsizetype oldSize = m_points.size();
+    const qsizetype removed = qMax(0, oldSize + points.size() - m_capacity);
+    if (removed == 0 && points.isEmpty())
+        return;
+
+    if (removed > 0) {
+        m_points.remove(0, removed);
+        markPointsRemoved(0, removed);
+    }
+    if (m_points.capacity() < 2 * m_capacity)
+        m_points.reserve(2 * m_capacity);
+    for (const QPointF &point : points)
+        m_points.append(point);
+    markPointsAppended(points.size());
+
+    bool callSignal = false;
+    if (removed > 0 && !m_selectedPoints.isEmpty()) {
+        QSet<qsizetype> selectedAfterRemoving;
+        for (const qsizetype &selectedPointIndex : std::as_const(m_selectedPoints)) {
+            if (selectedPointIndex >= removed)
+                selectedAfterRemoving << selectedPointIndex - removed;
+        }
+        m_selectedPoints = selectedAfterRemoving;
+        callSignal = true;
+    }
+
+    emit q->windowAdvanced(removed, points.size());
+    if (m_points.size() != oldSize)
+        emit q->countChanged();
+    if (callSignal)
+        emit q->selectedPointsChanged();
+}
+
+void QXYSeriesPrivate::trimToCapacity()
+{
+    if (m_capacity > 0 && m_points.size() > m_capacity)
+        appendToWindow({});
+}
+
+// Returns the indexes of the points the series should be drawn from, or an empty list
+// when it should be drawn from all of them. scale and offset map x values to device pixel
+// columns, and are only used with PixelMinMax. The result is cached until points,
+// decimation settings, or the mapping change.
+const QList<qsizetype> &QXYSeriesPrivate::decimatedIndexes(qreal scale, qreal offset)
+{
+    Q_Q(QXYSeries);
+
+    const auto type = q->type();
+    const bool pixelMinMax = m_decimationMode == QXYSeries::DecimationMode::PixelMinMax
+                             && type == QAbstractSeries::SeriesType::Line;
+    const bool lttb = m_decimationMode == QXYSeries::DecimationMode::LargestTriangleThreeBuckets
+                      && type != QAbstractSeries::SeriesType::Scatter;
+
+    if (!pixelMinMax && !lttb) {
+        invalidateDecimation();
+        return m_decimatedIndexes;
+    }
+
+    if (hasValidDecimation()
+        && (lttb || (m_decimatedScale == scale && m_decimatedOffset == offset))) {
+        return m_decimatedIndexes;
+    }
+
+    if (pixelMinMax)
+        decimatePixelMinMax(m_points, scale, offset, m_decimatedIndexes);
+    else
+        decimateLargestTriangleThreeBuckets(m_points, m_decimationTarget, m_decimatedIndexes);
+
+    m_decimatedRevision = m_pointsRevision;
+    m_decimatedScale = scale;
+    m_decimatedOffset = offset;
+    m_decimatedValid = true;
+    return m_decimatedIndexes;
+}
+
+bool QXYSeriesPrivate::hasValidDecimation() const
+{
+    return m_decimatedValid && m_decimatedRevision == m_pointsRevision;
+}
+
+// Must be called after every change of m_points, also when no signal is emitted for it,
+// so that the caches derived from the points are not used for other points. The
+// markPoints*() variants for appends, removals and replacements keep the sortedness of
+// the points known with work proportional to the change.
+void QXYSeriesPrivate::markPointsChanged()
+{
+    ++m_pointsRevision;
+    m_sortedFrom = -1;
+}
+
+// count points were appended to m_points
+void QXYSeriesPrivate::markPointsAppended(qsizetype count)
+{
+    ++m_pointsRevision;
+    if (m_sortedFrom < 0)
+        return;
+    for (qsizetype i = qMax(1, m_points.size() - count); i < m_points.size(); ++i) {
+        if (m_points.at(i).x() < m_points.at(i - 1).x())
+            m_sortedFrom = i;
+    }
+}
+
+// count points starting from index were removed from m_points
+void QXYSeriesPrivate::markPointsRemoved(qsizetype index, qsizetype count)
+{
+    ++m_pointsRevision;
+    // Removing points keeps sorted points sorted, and removing from the front moves the
+    // sorted tail along
+    if (m_sortedFrom > 0)
+        m_sortedFrom = index == 0 ? qMax(0, m_sortedFrom - count) : -1;
+}
+
+// count points starting from index were replaced in m_points
+void QXYSeriesPrivate::markPointsReplaced(qsizetype index, qsizetype count)
+{
+    ++m_pointsRevision;
+    // A replacement just after the start of the sorted tail could extend it further back
+    if (m_sortedFrom < 0 || (index <= m_sortedFrom && m_sortedFrom > 0)) {
+        m_sortedFrom = -1;
+        return;
+    }
+    const qsizetype end = qMin(index + count + 1, m_points.size());
+    for (qsizetype i = qMax(1, index); i < end; ++i) {
+        if (m_points.at(i).x() < m_points.at(i - 1).x())
+            m_sortedFrom = i;
+    }
+}
+
+void QXYSeriesPrivate::invalidateDecimation()
+{
+    m_decimatedIndexes.clear();
+    m_decimatedValid = false;
+}
+
+// Returns true when the x values of the points never decrease, as with time series.
+// The points are only scanned after changes which the markPoints*() functions can't follow,
+// such as replacing all points.
+bool QXYSeriesPrivate::isSortedByX()
+{
+    if (m_sortedFrom < 0) {
+        m_sortedFrom = qMax(0, m_points.size() - 1);
+        while (m_sortedFrom > 0
+               && m_points.at(m_sortedFrom - 1).x() <= m_points.at(m_sortedFrom).x()) {
+            --m_sortedFrom;
+        }
+    }
+    return m_sortedFrom == 0;
+}
+
+// Collects into indexes the points needed to draw points as a polyline without visible
+// difference. Consecutive points which map to the same pixel column, floor(x * scale - offset),
+// are reduced to the first, the minimum, the maximum, and the last one of the run.
+void QXYSeriesPrivate::decimatePixelMinMax(const QList<QPointF> &points,
+                                           qreal scale,
+                                           qreal offset,
+                                           QList<qsizetype> &indexes)
+{
+    indexes.clear();
+    const qsizetype count = points.size();
+    if (count == 0)
+        return;
+
+    qsizetype first = 0;
+    qsizetype min = 0;
+    qsizetype max = 0;
+    qreal column = std::floor(points[0].x() * scale - offset);
+
+    auto appendRun = [&indexes, &first, &min, &max](qsizetype last) {
+        const qsizetype run[4] = {first, qMin(min, max), qMax(min, max), last};
+        for (qsizetype index : run) {
+            if (indexes.isEmpty() || indexes.last() != index)
+                indexes.append(index);
+        }
+    };
+
+    for (qsizetype i = 1; i < count; ++i) {
+        const QPointF &point = points[i];
+        const qreal pointColumn = std::floor(point.x() * scale - offset);
+        if (pointColumn != column) {
+            appendRun(i - 1);
+            first = min = max = i;
+            column = pointColumn;
+        } else if (point.y() < points[min].y()) {
+            min = i;
+        } else if (point.y() > points[max].y()) {
+            max = i;
+        }
+    }
+    appendRun(count - 1);
+}
+
+// Collects into indexes target points chosen with the Largest-Triangle-Three-Buckets
+// algorithm. The first and the last point are always kept, and from each bucket in between
+// the point forming the largest triangle with the previously kept point and the average
+// of the next bucket. Leaves indexes empty when no reduction is needed.
+void QXYSeriesPrivate::decimateLargestTriangleThreeBuckets(const QList<QPointF> &points,
+                                                           qsizetype target,
+                                                           QList<qsizetype> &indexes)
+{
+    indexes.clear();
+    const qsizetype count = points.size();
+    if (target < 3 || count <= target)
+        return;
+
+    indexes.reserve(target);
+    indexes.append(0);
+
+    const qreal bucketSize = qreal(count - 2) / qreal(target - 2);
+    qsizetype previous = 0;
+
+    for (qsizetype bucket = 0; bucket < target - 2; ++bucket) {
+        const qsizetype nextStart = qsizetype((bucket + 1) * bucketSize) + 1;
+        const qsizetype nextEnd = qMin(qsizetype((bucket + 2) * bucketSize) + 1, count);
+
+        qreal averageX = 0;
+        qreal averageY = 0;
+        for (qsizetype i = nextStart; i < nextEnd; ++i) {
+            averageX += points[i].x();
+            averageY += points[i].y();
+        }
+        const qsizetype nextCount = nextEnd - nextStart;
+        averageX /= nextCount;
+        averageY /= nextCount;
+
+        const qsizetype start = qsizetype(bucket * bucketSize) + 1;
+        const qsizetype end = nextStart;
+        const QPointF &a = points[previous];
+
+        qreal maxArea = -1;
+        qsizetype selected = start;
+        for (qsizetype i = start; i < end; ++i) {
+            // Twice the triangle area, the constant factor does not change the result
+            const qreal area = qAbs((a.x() - averageX) * (points[i].y() - a.y())
+                                    - (a.x() - points[i].x()) * (averageY - a.y()));
+            if (area > maxArea) {
+                maxArea = area;
+                selected = i;
+            }
+        }
+
+        indexes.append(selected);
+        previous = selected;
+    }
+
+    indexes.append(count - 1);
+}
+
 QT_END_NAMESPACE
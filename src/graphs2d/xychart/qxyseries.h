@@ -6,6 +6,7 @@
 
 #include <QtGraphs/qabstractseries.h>
 #include <QtGraphs/qgraphsglobal.h>
+#include <QtCore/qspan.h>
 
 QT_BEGIN_NAMESPACE
 class QModelIndex;
@@ -26,11 +27,26 @@ class Q_GRAPHS_EXPORT QXYSeries : public QAbstractSeries
     Q_PROPERTY(bool draggable READ isDraggable WRITE setDraggable NOTIFY draggableChanged FINAL)
     Q_PROPERTY(QList<qsizetype> selectedPoints READ selectedPoints NOTIFY selectedPointsChanged FINAL)
     Q_PROPERTY(qsizetype count READ count NOTIFY countChanged FINAL)
+    Q_PROPERTY(DecimationMode decimationMode READ decimationMode WRITE setDecimationMode NOTIFY
+                   decimationModeChanged REVISION(6, 9))
+    Q_PROPERTY(qsizetype decimationTarget READ decimationTarget WRITE setDecimationTarget NOTIFY
+                   decimationTargetChanged REVISION(6, 9))
+    Q_PROPERTY(qsizetype capacity READ capacity WRITE setCapacity NOTIFY capacityChanged
+                   REVISION(6, 9))
+    Q_PROPERTY(qsizetype pointDelegateLimit READ pointDelegateLimit WRITE setPointDelegateLimit
+                   NOTIFY pointDelegateLimitChanged REVISION(6, 9))
 
 protected:
     explicit QXYSeries(QXYSeriesPrivate &dd, QObject *parent = nullptr);
 
 public:
+    enum class DecimationMode {
+        None,
+        PixelMinMax,
+        LargestTriangleThreeBuckets,
+    };
+    Q_ENUM(DecimationMode)
+
     Q_INVOKABLE void append(qreal x, qreal y);
     Q_INVOKABLE void append(QPointF point);
     Q_INVOKABLE void append(const QList<QPointF> &points);
@@ -49,9 +65,14 @@ public:
     Q_INVOKABLE void removeMultiple(qsizetype index, qsizetype count);
     Q_INVOKABLE bool take(QPointF point);
 
+    Q_REVISION(6, 9) Q_INVOKABLE void appendRange(const QList<QPointF> &points);
+    Q_REVISION(6, 9) Q_INVOKABLE void insertRange(qsizetype index, const QList<QPointF> &points);
+    Q_REVISION(6, 9) Q_INVOKABLE void replaceRange(qsizetype index, const QList<QPointF> &points);
+
     ~QXYSeries() override;
 
     QList<QPointF> points() const;
+    QSpan<const QPointF> pointsSpan() const;
 
     QXYSeries &operator<<(QPointF point);
     QXYSeries &operator<<(const QList<QPointF> &points);
@@ -84,6 +105,20 @@ public:
     bool isDraggable() const;
     void setDraggable(bool newDraggable);
 
+    DecimationMode decimationMode() const;
+    void setDecimationMode(DecimationMode mode);
+
+    qsizetype decimationTarget() const;
+    void setDecimationTarget(qsizetype target);
+
+    QList<QPointF> decimatedPoints() const;
+
+    qsizetype capacity() const;
+    void setCapacity(qsizetype capacity);
+
+    qsizetype pointDelegateLimit() const;
+    void setPointDelegateLimit(qsizetype limit);
+
 Q_SIGNALS:
     void pointReplaced(qsizetype index);
     void pointRemoved(qsizetype index);
@@ -97,9 +132,17 @@ Q_SIGNALS:
     void draggableChanged();
     void seriesUpdated();
     void countChanged();
+    Q_REVISION(6, 9) void decimationModeChanged();
+    Q_REVISION(6, 9) void decimationTargetChanged();
+    Q_REVISION(6, 9) void capacityChanged();
+    Q_REVISION(6, 9) void pointDelegateLimitChanged();
+    Q_REVISION(6, 9) void windowAdvanced(qsizetype removedCount, qsizetype addedCount);
+    Q_REVISION(6, 9) void pointsAdded(qsizetype index, qsizetype count);
+    Q_REVISION(6, 9) void pointRangeReplaced(qsizetype index, qsizetype count);
 
 private:
     friend class PointRenderer;
+    friend class AreaRenderer;
     friend class QGraphPointAnimation;
     friend class QGraphTransition;
     Q_DECLARE_PRIVATE(QXYSeries)
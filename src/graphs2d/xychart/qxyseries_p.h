@@ -16,6 +16,7 @@
 #include <QtGraphs/qxyseries.h>
 #include <private/qabstractseries_p.h>
 #include <private/qgraphtransition_p.h>
+#include <QtCore/qspan.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -29,6 +30,29 @@ public:
     void setPointSelected(qsizetype index, bool selected, bool &callSignal);
     bool isPointSelected(qsizetype index) const;
 
+    void insertPoints(qsizetype index, QSpan<const QPointF> points);
+    void appendToWindow(QSpan<const QPointF> points);
+    void finishTransition();
+    void trimToCapacity();
+    void markPointsChanged();
+    void markPointsAppended(qsizetype count);
+    void markPointsRemoved(qsizetype index, qsizetype count);
+    void markPointsReplaced(qsizetype index, qsizetype count);
+
+    const QList<qsizetype> &decimatedIndexes(qreal scale, qreal offset);
+    bool hasValidDecimation() const;
+    void invalidateDecimation();
+
+    bool isSortedByX();
+
+    static void decimatePixelMinMax(const QList<QPointF> &points,
+                                    qreal scale,
+                                    qreal offset,
+                                    QList<qsizetype> &indexes);
+    static void decimateLargestTriangleThreeBuckets(const QList<QPointF> &points,
+                                                    qsizetype target,
+                                                    QList<qsizetype> &indexes);
+
 protected:
     QList<QPointF> m_points;
     QSet<qsizetype> m_selectedPoints;
@@ -37,6 +61,24 @@ protected:
     QQmlComponent *m_pointDelegate = nullptr;
     QGraphTransition *m_graphTransition = nullptr;
     bool m_draggable = false;
+    QXYSeries::DecimationMode m_decimationMode = QXYSeries::DecimationMode::None;
+    qsizetype m_decimationTarget = 1000;
+    // Maximum number of points when the series is used as a sliding window, 0 for no limit
+    qsizetype m_capacity = 0;
+    // Maximum number of point delegates, 0 for no limit
+    qsizetype m_pointDelegateLimit = 0;
+
+    // Bumped by markPointsChanged(), used to validate the caches derived from m_points
+    quint64 m_pointsRevision = 0;
+    QList<qsizetype> m_decimatedIndexes;
+    quint64 m_decimatedRevision = 0;
+    qreal m_decimatedScale = 0;
+    qreal m_decimatedOffset = 0;
+    bool m_decimatedValid = false;
+
+    // Start of the sorted tail, the last points whose x values never decrease, or -1 when
+    // not known. The points are sorted by x when this is 0.
+    qsizetype m_sortedFrom = 0;
 
 private:
     Q_DECLARE_PUBLIC(QXYSeries)
@@ -7,6 +7,7 @@
 #include <QtGraphs/QSplineSeries>
 #endif
 #include <QtGraphs/QValueAxis>
+#include <QtGraphs/private/coloredgeometry_p.h>
 #include <QtQml/QQmlComponent>
 #include <QtTest/QtTest>
 
@@ -28,6 +29,13 @@ private slots:
     void initializePropertiesWithSpline();
 #endif
     void invalidProperties();
+    void selectionUpdatesSeries();
+
+    void columnsOfTwoPointLowerSeries();
+    void columnsOfEdgesOfDifferentRange();
+    void columnsOfUnsortedPoints();
+    void strokeJoinsDontOverlap();
+    void featheredFill();
 
 private:
     QAreaSeries *m_series;
@@ -236,5 +244,124 @@ void tst_area::invalidProperties()
     QCOMPARE(m_series->valuesMultiplier(), 0.0);
 }
 
+void tst_area::selectionUpdatesSeries()
+{
+    // Selecting an area by clicking it only polishes the area series again
+    QSignalSpy updateSpy(m_series, &QAbstractSeries::update);
+    m_series->setSelected(true);
+    QCOMPARE(updateSpy.size(), 1);
+    m_series->setSelected(true);
+    QCOMPARE(updateSpy.size(), 1);
+    m_series->setSelected(false);
+    QCOMPARE(updateSpy.size(), 2);
+}
+
+void tst_area::columnsOfTwoPointLowerSeries()
+{
+    const QList<QPointF> upper = { { 0, 4 }, { 1, 5 }, { 2, 4 }, { 3, 5 }, { 4, 4 } };
+    const QList<QPointF> lower = { { 0, 0 }, { 4, 2 } };
+    QList<QPointF> columns;
+    QVERIFY(areaColumns(upper, lower, columns));
+
+    // The lower line is sampled at every upper point
+    const QList<QPointF> expected = { { 0, 4 }, { 0, 0 },   { 1, 5 }, { 1, 0.5 },
+                                      { 2, 4 }, { 2, 1 },   { 3, 5 }, { 3, 1.5 },
+                                      { 4, 4 }, { 4, 2 } };
+    QCOMPARE(columns, expected);
+}
+
+void tst_area::columnsOfEdgesOfDifferentRange()
+{
+    const QList<QPointF> upper = { { 0, 2 }, { 4, 2 } };
+    const QList<QPointF> lower = { { 1, 0 }, { 3, 0 } };
+    QList<QPointF> columns;
+    QVERIFY(areaColumns(upper, lower, columns));
+
+    // The ends of the lower edge are joined to the ends of the upper one
+    const QList<QPointF> expected = { { 0, 2 }, { 0, 2 }, { 1, 2 }, { 1, 0 },
+                                      { 3, 2 }, { 3, 0 }, { 4, 2 }, { 4, 2 } };
+    QCOMPARE(columns, expected);
+}
+
+void tst_area::columnsOfUnsortedPoints()
+{
+    const QList<QPointF> upper = { { 0, 0 }, { 2, 1 }, { 1, 2 } };
+    const QList<QPointF> lower = { { 0, 0 }, { 2, 0 } };
+    QList<QPointF> columns;
+    QVERIFY(!areaColumns(upper, lower, columns));
+    QVERIFY(columns.isEmpty());
+}
+
+static qreal triangleArea(QPointF a, QPointF b, QPointF c)
+{
+    return qAbs((b.x() - a.x()) * (c.y() - a.y()) - (c.x() - a.x()) * (b.y() - a.y())) / 2;
+}
+
+// Area of the triangles, and the smallest and largest alpha of their vertices
+static qreal trianglesArea(const ColoredVertices &vertices, int *minAlpha = nullptr,
+                           int *maxAlpha = nullptr)
+{
+    qreal area = 0;
+    for (qsizetype i = 0; i < vertices.size(); i += 3) {
+        const QPointF a(vertices[i].x, vertices[i].y);
+        const QPointF b(vertices[i + 1].x, vertices[i + 1].y);
+        const QPointF c(vertices[i + 2].x, vertices[i + 2].y);
+        area += triangleArea(a, b, c);
+    }
+    if (minAlpha && maxAlpha) {
+        *minAlpha = 255;
+        *maxAlpha = 0;
+        for (const auto &vertex : vertices) {
+            *minAlpha = qMin(*minAlpha, int(vertex.a));
+            *maxAlpha = qMax(*maxAlpha, int(vertex.a));
+        }
+    }
+    return area;
+}
+
+void tst_area::strokeJoinsDontOverlap()
+{
+    const QList<QPointF> square = { { 0, 0 }, { 10, 0 }, { 10, 10 }, { 0, 10 } };
+    for (qreal width : { 2.0, 0.5 }) {
+        ColoredVertices vertices;
+        strokePolygon(square, width, 1.0, qRgba(255, 255, 255, 255), vertices);
+        QCOMPARE(vertices.size() % 3, 0);
+
+        // The triangles cover the stroke and its antialiased edges exactly once
+        int minAlpha = 0;
+        int maxAlpha = 0;
+        const qreal area = trianglesArea(vertices, &minAlpha, &maxAlpha);
+        const qreal halfWidth = width / 2 + 0.5;
+        QCOMPARE(area, (10 + 2 * halfWidth) * (10 + 2 * halfWidth)
+                           - (10 - 2 * halfWidth) * (10 - 2 * halfWidth));
+
+        // Strokes thinner than the antialiasing are drawn with partial coverage
+        QCOMPARE(maxAlpha, qRound(255 * qMin(1.0, width)));
+        QCOMPARE(minAlpha, 0);
+    }
+}
+
+void tst_area::featheredFill()
+{
+    // Clockwise and counter-clockwise polygons both get outward miters
+    QList<QPointF> square = { { 0, 0 }, { 10, 0 }, { 10, 10 }, { 0, 10 } };
+    for (int i = 0; i < 2; ++i) {
+        QList<QPointF> miters;
+        polygonMiters(square, miters);
+        QCOMPARE(miters.size(), square.size());
+        for (qsizetype k = 0; k < square.size(); ++k) {
+            QCOMPARE(miters[k].x(), square[k].x() > 5 ? 1.0 : -1.0);
+            QCOMPARE(miters[k].y(), square[k].y() > 5 ? 1.0 : -1.0);
+        }
+
+        // The ring reaches half a pixel in and out of the square
+        ColoredVertices vertices;
+        featherPolygon(square, miters, 1.0, qRgba(255, 255, 255, 255), vertices);
+        QCOMPARE(trianglesArea(vertices), 11.0 * 11.0 - 9.0 * 9.0);
+
+        std::reverse(square.begin(), square.end());
+    }
+}
+
 QTEST_MAIN(tst_area)
 #include "tst_area.moc"
@@ -2,6 +2,11 @@
 // SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
 
 #include <QtGraphs/QDateTimeAxis>
+#include <QtGraphs/QGraphsTheme>
+#include <QtGraphs/QValueAxis>
+#include <QtGraphs/private/axisrenderer_p.h>
+#include <QtGraphs/private/datetimeticks_p.h>
+#include <QtGraphs/private/qgraphsview_p.h>
 #include <QtTest/QtTest>
 #include "qtestcase.h"
 
@@ -21,6 +26,13 @@ private slots:
     void initializeProperties();
     void invalidProperties();
 
+    void calendarTickSteps_data();
+    void calendarTickSteps();
+    void calendarTickAlignment();
+    void calendarTickMonths();
+    void calendarTickDaylightSaving();
+    void calendarTickLinesMatchLabels();
+
 private:
     QDateTimeAxis *m_axis;
 };
@@ -106,5 +118,167 @@ void tst_datetimeaxis::invalidProperties()
     QCOMPARE(m_axis->tickInterval(), 0);
 }
 
+void tst_datetimeaxis::calendarTickSteps_data()
+{
+    QTest::addColumn<QDateTime>("min");
+    QTest::addColumn<QDateTime>("max");
+    QTest::addColumn<double>("stepMSecs");
+    QTest::addColumn<int>("stepDays");
+    QTest::addColumn<int>("stepMonths");
+    QTest::addColumn<qsizetype>("count");
+
+    const QDateTime start(QDate(2024, 1, 1), QTime(0, 0), QTimeZone::UTC);
+    QTest::newRow("seconds") << start << start.addSecs(10) << 1000.0 << 0 << 0 << qsizetype(11);
+    QTest::newRow("minutes") << start << start.addSecs(3600) << 600000.0 << 0 << 0
+                             << qsizetype(7);
+    QTest::newRow("hours") << start << start.addDays(3) << 43200000.0 << 0 << 0 << qsizetype(7);
+    QTest::newRow("weeks") << start << start.addDays(28) << 604800000.0 << 7 << 0 << qsizetype(5);
+    QTest::newRow("months") << start << start.addYears(1) << 2 * 30.436875 * 86400000.0 << 0 << 2
+                            << qsizetype(7);
+    // Steps of years start from a multiple of the step counted from year 0
+    const QDateTime century(QDate(2000, 1, 1), QTime(0, 0), QTimeZone::UTC);
+    QTest::newRow("years") << century << century.addYears(30) << 60 * 30.436875 * 86400000.0 << 0
+                           << 60 << qsizetype(7);
+}
+
+void tst_datetimeaxis::calendarTickSteps()
+{
+    QFETCH(QDateTime, min);
+    QFETCH(QDateTime, max);
+    QFETCH(double, stepMSecs);
+    QFETCH(int, stepDays);
+    QFETCH(int, stepMonths);
+    QFETCH(qsizetype, count);
+
+    const DateTimeTicks ticks = DateTimeTicks::calendarTicks(min, max);
+    QCOMPARE(ticks.stepMSecs, stepMSecs);
+    QCOMPARE(ticks.stepDays, stepDays);
+    QCOMPARE(ticks.stepMonths, stepMonths);
+    QCOMPARE(ticks.count, count);
+    QCOMPARE(ticks.first, min);
+    QCOMPARE(ticks.msecsAt(count - 1), max.toMSecsSinceEpoch());
+}
+
+void tst_datetimeaxis::calendarTickAlignment()
+{
+    // Steps shorter than a day start from a whole step of the day
+    const QDateTime morning(QDate(2024, 5, 1), QTime(10, 7, 30), QTimeZone::UTC);
+    DateTimeTicks ticks = DateTimeTicks::calendarTicks(morning, morning.addSecs(50 * 60));
+    QCOMPARE(ticks.stepMSecs, 5 * 60 * 1000.0);
+    QCOMPARE(ticks.first, QDateTime(QDate(2024, 5, 1), QTime(10, 10), QTimeZone::UTC));
+    QCOMPARE(ticks.firstMSecs, ticks.first.toMSecsSinceEpoch());
+    QCOMPARE(ticks.count, qsizetype(10));
+
+    // Weeks start on Monday
+    const QDateTime wednesday(QDate(2024, 5, 1), QTime(12, 0), QTimeZone::UTC);
+    ticks = DateTimeTicks::calendarTicks(wednesday, wednesday.addDays(60));
+    QCOMPARE(ticks.stepDays, 7);
+    QCOMPARE(ticks.first, QDateTime(QDate(2024, 5, 6), QTime(0, 0), QTimeZone::UTC));
+    QCOMPARE(ticks.count, qsizetype(8));
+    for (qsizetype i = 0; i < ticks.count; ++i) {
+        const QDateTime tick = QDateTime::fromMSecsSinceEpoch(ticks.msecsAt(i), QTimeZone::UTC);
+        QCOMPARE(tick.date().dayOfWeek(), int(Qt::Monday));
+        QCOMPARE(tick.time(), QTime(0, 0));
+    }
+
+    // Month steps start from a multiple of the step counted from year 0
+    const QDateTime february(QDate(2024, 2, 15), QTime(0, 0), QTimeZone::UTC);
+    ticks = DateTimeTicks::calendarTicks(february, february.addYears(1));
+    QCOMPARE(ticks.stepMonths, 2);
+    QCOMPARE(ticks.first, QDateTime(QDate(2024, 3, 1), QTime(0, 0), QTimeZone::UTC));
+    QCOMPARE(ticks.count, qsizetype(6));
+}
+
+void tst_datetimeaxis::calendarTickMonths()
+{
+    const QDateTime min(QDate(2024, 1, 10), QTime(0, 0), QTimeZone::UTC);
+    const DateTimeTicks ticks = DateTimeTicks::calendarTicks(min, min.addMonths(9));
+    QCOMPARE(ticks.stepMonths, 1);
+    QCOMPARE(ticks.count, qsizetype(9));
+
+    // Ticks are on the first day of each month, although the months differ in length
+    for (qsizetype i = 0; i < ticks.count; ++i) {
+        const QDateTime tick = QDateTime::fromMSecsSinceEpoch(ticks.msecsAt(i), QTimeZone::UTC);
+        QCOMPARE(tick, QDateTime(QDate(2024, int(2 + i), 1), QTime(0, 0), QTimeZone::UTC));
+    }
+}
+
+void tst_datetimeaxis::calendarTickDaylightSaving()
+{
+    const QTimeZone berlin("Europe/Berlin");
+    if (!berlin.isValid())
+        QSKIP("Time zone Europe/Berlin is not available");
+
+    // Daylight saving time ends on October 27th, making that day 25 hours long
+    const QDateTime min(QDate(2024, 10, 24), QTime(0, 0), berlin);
+    const QDateTime max(QDate(2024, 11, 1), QTime(0, 0), berlin);
+    const DateTimeTicks ticks = DateTimeTicks::calendarTicks(min, max);
+    QCOMPARE(ticks.stepDays, 1);
+    QCOMPARE(ticks.count, qsizetype(9));
+
+    // Each tick is on midnight of the next day, so no date is repeated
+    for (qsizetype i = 0; i < ticks.count; ++i) {
+        const QDateTime tick = QDateTime::fromMSecsSinceEpoch(ticks.msecsAt(i), berlin);
+        QCOMPARE(tick.date(), min.date().addDays(i));
+        QCOMPARE(tick.time(), QTime(0, 0));
+    }
+    QCOMPARE(ticks.msecsAt(4) - ticks.msecsAt(3), qint64(25 * 3600 * 1000));
+}
+
+void tst_datetimeaxis::calendarTickLinesMatchLabels()
+{
+    QGraphsView view;
+    view.setSize(QSizeF(400, 300));
+    view.setTheme(new QGraphsTheme(&view));
+    auto axisX = new QDateTimeAxis(&view);
+    const QDateTime min(QDate(2024, 1, 1), QTime(0, 0), QTimeZone::UTC);
+    axisX->setMin(min);
+    axisX->setMax(min.addMonths(9));
+    // Rotated labels are text items, which can be located
+    axisX->setLabelsAngle(45);
+    view.setAxisX(axisX);
+    view.setAxisY(new QValueAxis(&view));
+    view.ensurePolished();
+
+    AxisRenderer *renderer = view.m_axisRenderer;
+    QVERIFY(renderer);
+    const DateTimeTicks &ticks = renderer->m_axisHorizontalDateTimeTicks;
+    QCOMPARE(ticks.stepMonths, 1);
+    QCOMPARE(ticks.count, qsizetype(10));
+    // Months differ in length, so the evenly spaced grid and ticker shaders are not used
+    QVERIFY(!renderer->m_axisTickerHorizontal->isVisible());
+    QCOMPARE(renderer->m_axisGrid->gridVisibility().y(), 0.0f);
+
+    // Each line is one strokeLine of 18 vertices. Grid lines span the plot area.
+    const auto &vertices = renderer->m_dateTimeLineVertices;
+    QCOMPARE(vertices.size() % 18, 0);
+    const QRectF plotArea = view.plotArea();
+    QList<qreal> gridLines;
+    for (qsizetype i = 0; i < vertices.size(); i += 18) {
+        qreal left = vertices[i].x;
+        qreal right = left;
+        qreal top = vertices[i].y;
+        qreal bottom = top;
+        for (qsizetype j = i; j < i + 18; ++j) {
+            left = qMin(left, qreal(vertices[j].x));
+            right = qMax(right, qreal(vertices[j].x));
+            top = qMin(top, qreal(vertices[j].y));
+            bottom = qMax(bottom, qreal(vertices[j].y));
+        }
+        if (qFuzzyCompare(top, plotArea.top()) && qFuzzyCompare(bottom, plotArea.bottom()))
+            gridLines << (left + right) * 0.5;
+    }
+    QCOMPARE(gridLines.size(), ticks.count);
+
+    // The label of each tick is centered on its grid line
+    const auto &labels = renderer->m_xAxisTextItems;
+    for (qsizetype i = 0; i < ticks.count; ++i) {
+        QVERIFY(labels[i]->isVisible());
+        QCOMPARE_LT(qAbs(labels[i]->x() + labels[i]->width() * 0.5 - gridLines[i]), 0.01);
+    }
+    // January is longer than February
+    QCOMPARE_GT(gridLines[1] - gridLines[0], gridLines[2] - gridLines[1]);
+}
+
 QTEST_MAIN(tst_datetimeaxis)
 #include "tst_datetimeaxis.moc"
@@ -22,6 +22,7 @@ private slots:
     void selectDeselectSum();
     void appendInsertRemove();
     void replaceAt();
+    void bulkValues();
 
 private:
     QBarSet *m_set;
@@ -240,5 +241,61 @@ void tst_barset::replaceAt()
     QCOMPARE(spy1.size(), 3);
 }
 
+void tst_barset::bulkValues()
+{
+    QVERIFY(m_set);
+    QVERIFY(m_set->valuesSpan().isEmpty());
+
+    QSignalSpy valuesSpy(m_set, &QBarSet::valuesChanged);
+    QSignalSpy addedSpy(m_set, &QBarSet::valuesAdded);
+    QSignalSpy changedSpy(m_set, &QBarSet::valueChanged);
+    QSignalSpy selectedSpy(m_set, &QBarSet::selectedBarsChanged);
+
+    const QList<qreal> nums = {10, 20, 30, 40};
+    m_set->replaceValues(nums);
+    QCOMPARE(m_set->count(), nums.size());
+    QCOMPARE(valuesSpy.size(), 1);
+
+    const QSpan<const qreal> span = m_set->valuesSpan();
+    QCOMPARE(span.size(), nums.size());
+    for (qsizetype i = 0; i < nums.size(); ++i)
+        QCOMPARE(span[i], nums[i]);
+    QCOMPARE(span.data(), m_set->valuesSpan().data());
+
+    // Setting equal values changes nothing
+    m_set->replaceValues(nums);
+    QCOMPARE(valuesSpy.size(), 1);
+
+    // Selections within the new values stay
+    m_set->selectBars({1, 3});
+    QCOMPARE(selectedSpy.size(), 1);
+    const qreal shorter[] = {1, 2, 3};
+    m_set->replaceValues(shorter);
+    QCOMPARE(m_set->count(), 3);
+    QCOMPARE(m_set->at(2), 3);
+    QCOMPARE(m_set->selectedBars(), QList<qsizetype>{1});
+    QCOMPARE(selectedSpy.size(), 2);
+    QCOMPARE(valuesSpy.size(), 2);
+
+    // Invalid values are ignored
+    QTest::ignoreMessage(QtWarningMsg, "Ignored NaN, Inf, or -Inf value.");
+    m_set->replaceValues({5, qQNaN(), 6});
+    QCOMPARE(m_set->count(), 2);
+    QCOMPARE(m_set->at(1), 6);
+    QCOMPARE(valuesSpy.size(), 3);
+
+    // A braced list, and an empty one
+    m_set->replaceValues({7, 8});
+    QCOMPARE(m_set->count(), 2);
+    QCOMPARE(m_set->at(0), 7);
+    m_set->replaceValues({});
+    QCOMPARE(m_set->count(), 0);
+    QCOMPARE(valuesSpy.size(), 5);
+
+    // No per value signals
+    QCOMPARE(addedSpy.size(), 0);
+    QCOMPARE(changedSpy.size(), 0);
+}
+
 QTEST_MAIN(tst_barset)
 #include "tst_barset.moc"
@@ -22,6 +22,8 @@ private slots:
     void initializeProperties();
     void invalidProperties();
 
+    void decimatedPoints();
+
 private:
     QLineSeries *m_series;
 };
@@ -60,6 +62,8 @@ void tst_lines::initialProperties()
     QCOMPARE(m_series->color(), QColor(Qt::transparent));
     QCOMPARE(m_series->selectedColor(), QColor(Qt::transparent));
     QCOMPARE(m_series->isDraggable(), false);
+    QCOMPARE(m_series->decimationMode(), QXYSeries::DecimationMode::None);
+    QCOMPARE(m_series->decimationTarget(), 1000);
 
     // Properties from QAbstractSeries
     QCOMPARE(m_series->name(), "");
@@ -81,6 +85,8 @@ void tst_lines::initializeProperties()
     QSignalSpy spy3(m_series, &QLineSeries::colorChanged);
     QSignalSpy spy4(m_series, &QLineSeries::selectedColorChanged);
     QSignalSpy spy5(m_series, &QLineSeries::draggableChanged);
+    QSignalSpy spy12(m_series, &QLineSeries::decimationModeChanged);
+    QSignalSpy spy13(m_series, &QLineSeries::decimationTargetChanged);
 
     QSignalSpy spy6(m_series, &QLineSeries::nameChanged);
     QSignalSpy spy7(m_series, &QLineSeries::visibleChanged);
@@ -98,6 +104,8 @@ void tst_lines::initializeProperties()
     m_series->setColor("#ff0000");
     m_series->setSelectedColor("#0000ff");
     m_series->setDraggable(true);
+    m_series->setDecimationMode(QXYSeries::DecimationMode::PixelMinMax);
+    m_series->setDecimationTarget(500);
 
     m_series->setName("LineSeries");
     m_series->setVisible(false);
@@ -113,6 +121,8 @@ void tst_lines::initializeProperties()
     QCOMPARE(m_series->color(), "#ff0000");
     QCOMPARE(m_series->selectedColor(), "#0000ff");
     QCOMPARE(m_series->isDraggable(), true);
+    QCOMPARE(m_series->decimationMode(), QXYSeries::DecimationMode::PixelMinMax);
+    QCOMPARE(m_series->decimationTarget(), 500);
 
     QCOMPARE(m_series->name(), "LineSeries");
     QCOMPARE(m_series->isVisible(), false);
@@ -128,6 +138,8 @@ void tst_lines::initializeProperties()
     QCOMPARE(spy3.size(), 1);
     QCOMPARE(spy4.size(), 1);
     QCOMPARE(spy5.size(), 1);
+    QCOMPARE(spy12.size(), 1);
+    QCOMPARE(spy13.size(), 1);
 
     QCOMPARE(spy6.size(), 1);
     QCOMPARE(spy7.size(), 1);
@@ -149,6 +161,47 @@ void tst_lines::invalidProperties()
 
     m_series->setValuesMultiplier(-1.0); // range 0...1
     QCOMPARE(m_series->valuesMultiplier(), 0.0);
+
+    m_series->setDecimationTarget(2); // minimum 3
+    QCOMPARE(m_series->decimationTarget(), 1000);
+}
+
+void tst_lines::decimatedPoints()
+{
+    QVERIFY(m_series);
+
+    QList<QPointF> points;
+    for (int i = 0; i < 10000; ++i)
+        points << QPointF(i, i == 5000 ? 100.0 : qSin(i * 0.01));
+    m_series->replace(points);
+
+    // No decimation
+    QCOMPARE(m_series->decimatedPoints(), points);
+
+    // Pixel decimation needs a rendered graph, until then all points are returned
+    m_series->setDecimationMode(QXYSeries::DecimationMode::PixelMinMax);
+    QCOMPARE(m_series->decimatedPoints(), points);
+
+    m_series->setDecimationMode(QXYSeries::DecimationMode::LargestTriangleThreeBuckets);
+    m_series->setDecimationTarget(100);
+    QList<QPointF> decimated = m_series->decimatedPoints();
+    QCOMPARE(decimated.size(), 100);
+    QCOMPARE(decimated.first(), points.first());
+    QCOMPARE(decimated.last(), points.last());
+    // The spike is kept
+    QVERIFY(decimated.contains(QPointF(5000, 100.0)));
+    for (qsizetype i = 1; i < decimated.size(); ++i)
+        QVERIFY(decimated[i - 1].x() < decimated[i].x());
+
+    // Changing points updates the result
+    m_series->removeMultiple(100, 9850);
+    decimated = m_series->decimatedPoints();
+    QCOMPARE(decimated.size(), 100);
+    QCOMPARE(decimated.last(), points.last());
+
+    // Series smaller than the target are not reduced
+    m_series->setDecimationTarget(1000);
+    QCOMPARE(m_series->decimatedPoints(), m_series->points());
 }
 
 QTEST_MAIN(tst_lines)
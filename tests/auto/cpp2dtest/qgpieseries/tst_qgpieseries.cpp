@@ -1,8 +1,11 @@
 // Copyright (C) 2024 The Qt Company Ltd.
 // SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
 
+#include <QtGraphs/QGraphsTheme>
 #include <QtGraphs/QPieSeries>
 #include <QtGraphs/QPieSlice>
+#include <QtGraphs/private/pierenderer_p.h>
+#include <QtGraphs/private/qgraphsview_p.h>
 #include <QtTest/QtTest>
 
 QT_USE_NAMESPACE
@@ -26,6 +29,7 @@ private slots:
     void calculatedValues();
     void sliceSeries();
     void destruction();
+    void generateChangedSlices();
 
 private:
     void verifyCalculatedData(const QPieSeries &series, bool *ok);
@@ -597,5 +601,62 @@ QList<QPoint> tst_qgpieseries::slicePoints(QRectF rect)
     return points;
 }
 
+void tst_qgpieseries::generateChangedSlices()
+{
+    QGraphsView view;
+    view.setSize(QSizeF(200, 200));
+    view.setTheme(new QGraphsTheme(&view));
+    auto series = new QPieSeries(&view);
+    series->append("1", 1);
+    series->append("2", 2);
+    series->append("3", 3);
+    view.addSeries(series);
+    view.ensurePolished();
+
+    PieRenderer *renderer = view.m_pieRenderer;
+    QVERIFY(renderer);
+    auto &seriesNode = renderer->m_seriesNodes[series];
+    QVERIFY(seriesNode.dirty);
+    for (auto slice : series->slices())
+        QVERIFY(!renderer->m_activeSlices.value(slice).vertices.isEmpty());
+
+    // Drops the vertices of the slices and marks the node as synced, so that only the
+    // slices generated by the next polish have vertices
+    auto resetGeometry = [&] {
+        for (auto &sliceData : renderer->m_activeSlices)
+            sliceData.vertices.clear();
+        seriesNode.dirty = false;
+    };
+    auto generatedSlices = [&] {
+        QList<qsizetype> generated;
+        for (qsizetype i = 0; i < series->count(); ++i) {
+            if (!renderer->m_activeSlices.value(series->slices().at(i)).vertices.isEmpty())
+                generated.append(i);
+        }
+        return generated;
+    };
+
+    // Polishing the series again doesn't touch the node of unchanged slices
+    resetGeometry();
+    view.setTheme(new QGraphsTheme(&view));
+    view.ensurePolished();
+    QVERIFY(!seriesNode.dirty);
+    QCOMPARE(generatedSlices(), QList<qsizetype>());
+
+    // Exploding a slice moves only that slice
+    resetGeometry();
+    series->slices().at(1)->setExploded(true);
+    view.ensurePolished();
+    QVERIFY(seriesNode.dirty);
+    QCOMPARE(generatedSlices(), QList<qsizetype>({ 1 }));
+
+    // A new value changes the angles of all slices
+    resetGeometry();
+    series->slices().at(0)->setValue(4);
+    view.ensurePolished();
+    QVERIFY(seriesNode.dirty);
+    QCOMPARE(generatedSlices(), QList<qsizetype>({ 0, 1, 2 }));
+}
+
 QTEST_MAIN(tst_qgpieseries)
 #include "tst_qgpieseries.moc"
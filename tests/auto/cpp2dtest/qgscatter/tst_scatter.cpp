@@ -1,9 +1,13 @@
 // Copyright (C) 2024 The Qt Company Ltd.
 // SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
 
+#include <QtGraphs/QGraphsTheme>
 #include <QtGraphs/QScatterSeries>
 #include <QtGraphs/QValueAxis>
+#include <QtGraphs/private/pointrenderer_p.h>
+#include <QtGraphs/private/qgraphsview_p.h>
 #include <QtQml/QQmlComponent>
+#include <QtQml/QQmlEngine>
 #include <QtTest/QtTest>
 
 class tst_scatter : public QObject
@@ -22,6 +26,8 @@ private slots:
     void initializeProperties();
     void invalidProperties();
 
+    void virtualizedPointDelegates();
+
 private:
     QScatterSeries *m_series;
 };
@@ -58,6 +64,7 @@ void tst_scatter::initialProperties()
     QCOMPARE(m_series->color(), QColor(Qt::transparent));
     QCOMPARE(m_series->selectedColor(), QColor(Qt::transparent));
     QCOMPARE(m_series->isDraggable(), false);
+    QCOMPARE(m_series->pointDelegateLimit(), 0);
 
     // Properties from QAbstractSeries
     QCOMPARE(m_series->name(), "");
@@ -79,6 +86,7 @@ void tst_scatter::initializeProperties()
     QSignalSpy spy1(m_series, &QScatterSeries::colorChanged);
     QSignalSpy spy2(m_series, &QScatterSeries::selectedColorChanged);
     QSignalSpy spy3(m_series, &QScatterSeries::draggableChanged);
+    QSignalSpy spy10(m_series, &QScatterSeries::pointDelegateLimitChanged);
 
     QSignalSpy spy4(m_series, &QScatterSeries::nameChanged);
     QSignalSpy spy5(m_series, &QScatterSeries::visibleChanged);
@@ -92,6 +100,7 @@ void tst_scatter::initializeProperties()
     m_series->setColor("#ff0000");
     m_series->setSelectedColor("#0000ff");
     m_series->setDraggable(true);
+    m_series->setPointDelegateLimit(100);
 
     m_series->setName("LineSeries");
     m_series->setVisible(false);
@@ -105,6 +114,7 @@ void tst_scatter::initializeProperties()
     QCOMPARE(m_series->color(), "#ff0000");
     QCOMPARE(m_series->selectedColor(), "#0000ff");
     QCOMPARE(m_series->isDraggable(), true);
+    QCOMPARE(m_series->pointDelegateLimit(), 100);
 
     QCOMPARE(m_series->name(), "LineSeries");
     QCOMPARE(m_series->isVisible(), false);
@@ -125,6 +135,7 @@ void tst_scatter::initializeProperties()
     QCOMPARE(spy7.size(), 1);
     QCOMPARE(spy8.size(), 1);
     QCOMPARE(spy9.size(), 1);
+    QCOMPARE(spy10.size(), 1);
 }
 
 void tst_scatter::invalidProperties()
@@ -139,6 +150,65 @@ void tst_scatter::invalidProperties()
     m_series->setValuesMultiplier(-1.0); // range 0...1
     // TODO: QTBUG-121721
     // QCOMPARE(m_series->valuesMultiplier(), 0.0);
+
+    m_series->setPointDelegateLimit(-1);
+    QCOMPARE(m_series->pointDelegateLimit(), 0);
+}
+
+void tst_scatter::virtualizedPointDelegates()
+{
+    QQmlEngine engine;
+    QQmlComponent marker(&engine);
+    marker.setData("import QtQuick\nItem { width: 10; height: 10 }", QUrl());
+    QVERIFY2(marker.isReady(), qPrintable(marker.errorString()));
+
+    QGraphsView view;
+    view.setSize(QSizeF(400, 300));
+    view.setTheme(new QGraphsTheme(&view));
+    auto axisX = new QValueAxis(&view);
+    axisX->setRange(0, 10);
+    auto axisY = new QValueAxis(&view);
+    axisY->setRange(0, 10);
+    view.setAxisX(axisX);
+    view.setAxisY(axisY);
+
+    // Not sorted by x, and the points of even indexes are far above the plot area
+    auto series = new QScatterSeries(&view);
+    series->setPointDelegate(&marker);
+    for (int i = 0; i < 100; ++i)
+        series->append((i * 37) % 10, i % 2 ? 5 : 100);
+    view.addSeries(series);
+    view.ensurePolished();
+
+    PointRenderer *renderer = view.m_pointRenderer;
+    QVERIFY(renderer);
+    auto group = renderer->m_groups.value(series);
+    QVERIFY(group);
+    QCOMPARE(group->markers.size(), 50);
+    for (auto it = group->markers.cbegin(); it != group->markers.cend(); ++it) {
+        QCOMPARE(series->at(it.key()).y(), 5.0);
+        QVERIFY(it.value()->isVisible());
+    }
+    const qsizetype created = group->markers.size() + group->markerPool.size();
+    QCOMPARE(created, 50);
+
+    // Panning to the other points reuses the same items
+    axisY->setRange(95, 105);
+    view.ensurePolished();
+    QCOMPARE(group->markers.size(), 50);
+    for (auto it = group->markers.cbegin(); it != group->markers.cend(); ++it)
+        QCOMPARE(series->at(it.key()).y(), 100.0);
+    QCOMPARE(group->markers.size() + group->markerPool.size(), created);
+
+    // Only the points with the lowest indexes get a delegate within the limit
+    series->setPointDelegateLimit(20);
+    view.ensurePolished();
+    QCOMPARE(group->markers.size(), 20);
+    const auto indexes = group->markers.keys();
+    QCOMPARE(*std::max_element(indexes.cbegin(), indexes.cend()), 38);
+    QCOMPARE(group->markerPool.size(), created - 20);
+    for (auto item : std::as_const(group->markerPool))
+        QVERIFY(!item->isVisible());
 }
 
 QTEST_MAIN(tst_scatter)
@@ -4,6 +4,8 @@
 #include <QtGraphs/QSplineSeries>
 #include <QtGraphs/QValueAxis>
 #include <QtQml/QQmlComponent>
+#include <QtQml/QQmlParserStatus>
+#include <QtCore/qmath.h>
 #include <QtTest/QtTest>
 
 class tst_splines : public QObject
@@ -22,6 +24,7 @@ private slots:
     void initializeProperties();
     void splineSignals();
     void invalidProperties();
+    void incrementalControlPoints();
 
 private:
     QSplineSeries *m_series;
@@ -177,5 +180,52 @@ void tst_splines::invalidProperties()
     QCOMPARE(m_series->valuesMultiplier(), 0.0);
 }
 
+// Control points of the incremental solve may differ from a full solve by rounding only
+static bool fuzzyCompareControlPoints(const QList<QPointF> &actual, const QList<QPointF> &expected)
+{
+    if (actual.size() != expected.size())
+        return false;
+    for (qsizetype i = 0; i < actual.size(); ++i) {
+        const QPointF difference = actual.at(i) - expected.at(i);
+        if (qAbs(difference.x()) > 1e-6 || qAbs(difference.y()) > 1e-6)
+            return false;
+    }
+    return true;
+}
+
+void tst_splines::incrementalControlPoints()
+{
+    QVERIFY(m_series);
+
+    // Points are connected to the control point updates when the component is complete
+    QSplineSeries reference;
+    static_cast<QQmlParserStatus *>(m_series)->componentComplete();
+    static_cast<QQmlParserStatus *>(&reference)->componentComplete();
+
+    QList<QPointF> points;
+    for (int i = 0; i < 200; ++i)
+        points.append(QPointF(i, 10 * qSin(i * 0.3) + i % 7));
+
+    // More points than the incremental solve window on both sides of a change
+    m_series->replace(points.first(100));
+    reference.replace(m_series->points());
+    QVERIFY(fuzzyCompareControlPoints(m_series->getControlPoints(), reference.getControlPoints()));
+
+    for (qsizetype i = 100; i < points.size(); ++i) {
+        m_series->append(points.at(i));
+        reference.replace(m_series->points());
+        QVERIFY(fuzzyCompareControlPoints(m_series->getControlPoints(),
+                                          reference.getControlPoints()));
+    }
+
+    // Replacing in the middle, near the start and at the end
+    for (const qsizetype index : {150, 3, 0, 199, 120}) {
+        m_series->replace(index, QPointF(index, -25));
+        reference.replace(m_series->points());
+        QVERIFY(fuzzyCompareControlPoints(m_series->getControlPoints(),
+                                          reference.getControlPoints()));
+    }
+}
+
 #include "tst_splines.moc"
 QTEST_MAIN(tst_splines)
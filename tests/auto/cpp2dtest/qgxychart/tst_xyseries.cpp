@@ -22,6 +22,10 @@ private slots:
     void replaceAtClear();
     void find();
     void take();
+    void capacity();
+    void rangeOperations();
+    void pointsSpan();
+    void rangeFromOwnPoints();
 
 private:
     // QXYSeries is uncreatable, so testing is done through QScatterSeries
@@ -101,6 +105,7 @@ void tst_xyseries::appendInsertRemove()
     QVERIFY(m_series);
     QSignalSpy updateSpy(m_series, &QXYSeries::update);
     QSignalSpy pointAddedSpy(m_series, &QXYSeries::pointAdded);
+    QSignalSpy pointsAddedSpy(m_series, &QXYSeries::pointsAdded);
     QSignalSpy pointRemovedSpy(m_series, &QXYSeries::pointRemoved);
     QSignalSpy pointsRemovedSpy(m_series, &QXYSeries::pointsRemoved);
 
@@ -119,18 +124,19 @@ void tst_xyseries::appendInsertRemove()
     QCOMPARE(m_series->points(), points);
     QCOMPARE(pointAddedSpy.size(), 3);
 
-    // Append 3 more
+    // Append 3 more, with one notification for the list
     m_series->append(morepoints);
 
-    QCOMPARE(updateSpy.count(), 6);
+    QCOMPARE(updateSpy.count(), 4);
     QCOMPARE(m_series->points(), allpoints);
-    QCOMPARE(pointAddedSpy.size(), 6);
+    QCOMPARE(pointAddedSpy.size(), 3);
+    QCOMPARE(pointsAddedSpy.size(), 1);
 
     // Remove the first 3 one by one
     for (int i = 2; i >= 0; --i)
         m_series->remove(i);
 
-    QCOMPARE(updateSpy.count(), 9);
+    QCOMPARE(updateSpy.count(), 7);
     QCOMPARE(m_series->points(), morepoints);
     QCOMPARE(pointRemovedSpy.size(), 3);
 
@@ -139,14 +145,14 @@ void tst_xyseries::appendInsertRemove()
     m_series->insert(2, points[1]);
     m_series->insert(4, points[2]);
 
-    QCOMPARE(updateSpy.count(), 12);
+    QCOMPARE(updateSpy.count(), 10);
     QCOMPARE(m_series->points(), mixedpoints);
-    QCOMPARE(pointAddedSpy.size(), 9);
+    QCOMPARE(pointAddedSpy.size(), 6);
 
     // Remove first 3
     m_series->removeMultiple(0, 3);
 
-    QCOMPARE(updateSpy.count(), 13);
+    QCOMPARE(updateSpy.count(), 11);
     QCOMPARE(m_series->count(), 3);
     QCOMPARE(pointsRemovedSpy.size(), 1);
 
@@ -154,15 +160,15 @@ void tst_xyseries::appendInsertRemove()
     for (int i = 10; i < 13; ++i)
         m_series->append(i, i);
 
-    QCOMPARE(updateSpy.count(), 16);
+    QCOMPARE(updateSpy.count(), 14);
     QCOMPARE(m_series->count(), 6);
-    QCOMPARE(pointAddedSpy.size(), 12);
+    QCOMPARE(pointAddedSpy.size(), 9);
 
     // Remove 3 by qreals
     for (int i = 10; i < 13; ++i)
         m_series->remove(i, i);
 
-    QCOMPARE(updateSpy.count(), 19);
+    QCOMPARE(updateSpy.count(), 17);
     QCOMPARE(m_series->count(), 3);
     QCOMPARE(pointRemovedSpy.size(), 6);
 }
@@ -225,5 +231,191 @@ void tst_xyseries::take()
     QCOMPARE(m_series->count(), 4);
 }
 
+void tst_xyseries::capacity()
+{
+    QVERIFY(m_series);
+    QSignalSpy updateSpy(m_series, &QXYSeries::update);
+    QSignalSpy pointAddedSpy(m_series, &QXYSeries::pointAdded);
+    QSignalSpy pointsAddedSpy(m_series, &QXYSeries::pointsAdded);
+    QSignalSpy pointRemovedSpy(m_series, &QXYSeries::pointRemoved);
+    QSignalSpy windowSpy(m_series, &QXYSeries::windowAdvanced);
+    QSignalSpy countSpy(m_series, &QXYSeries::countChanged);
+
+    QCOMPARE(m_series->capacity(), 0);
+    m_series->setCapacity(3);
+    QCOMPARE(m_series->capacity(), 3);
+
+    // Filling up to the capacity appends normally
+    m_series->append({{0, 0}, {1, 1}, {2, 2}});
+    QCOMPARE(pointsAddedSpy.size(), 1);
+    QCOMPARE(windowSpy.size(), 0);
+    QCOMPARE(countSpy.size(), 1);
+
+    m_series->selectPoints({0, 2});
+
+    // Appending to a full series evicts the oldest point
+    updateSpy.clear();
+    m_series->append(3, 3);
+    QList<QPointF> expected = {{1, 1}, {2, 2}, {3, 3}};
+    QCOMPARE(m_series->points(), expected);
+    QCOMPARE(pointAddedSpy.size(), 0);
+    QCOMPARE(pointRemovedSpy.size(), 0);
+    QCOMPARE(windowSpy.size(), 1);
+    QCOMPARE(windowSpy.last().at(0).value<qsizetype>(), 1);
+    QCOMPARE(windowSpy.last().at(1).value<qsizetype>(), 1);
+    QCOMPARE(countSpy.size(), 1);
+    QVERIFY(updateSpy.size() >= 1);
+    // The selected point 0 was evicted and point 2 moved to index 1
+    QCOMPARE(m_series->selectedPoints(), QList<qsizetype>({1}));
+
+    // A batch emits a single notification
+    m_series->append({{4, 4}, {5, 5}});
+    expected = {{3, 3}, {4, 4}, {5, 5}};
+    QCOMPARE(m_series->points(), expected);
+    QCOMPARE(windowSpy.size(), 2);
+    QCOMPARE(windowSpy.last().at(0).value<qsizetype>(), 2);
+    QCOMPARE(windowSpy.last().at(1).value<qsizetype>(), 2);
+
+    // A batch larger than the capacity keeps its last points
+    m_series->append({{6, 6}, {7, 7}, {8, 8}, {9, 9}});
+    expected = {{7, 7}, {8, 8}, {9, 9}};
+    QCOMPARE(m_series->points(), expected);
+    QCOMPARE(windowSpy.size(), 3);
+    QCOMPARE(windowSpy.last().at(0).value<qsizetype>(), 3);
+    QCOMPARE(windowSpy.last().at(1).value<qsizetype>(), 3);
+    QCOMPARE(countSpy.size(), 1);
+
+    // Lowering the capacity removes the oldest points
+    m_series->setCapacity(2);
+    expected = {{8, 8}, {9, 9}};
+    QCOMPARE(m_series->points(), expected);
+    QCOMPARE(windowSpy.size(), 4);
+    QCOMPARE(countSpy.size(), 2);
+
+    // No limit
+    m_series->setCapacity(0);
+    m_series->append(10, 10);
+    QCOMPARE(m_series->count(), 3);
+    QCOMPARE(windowSpy.size(), 4);
+}
+
+void tst_xyseries::rangeOperations()
+{
+    QVERIFY(m_series);
+    QSignalSpy updateSpy(m_series, &QXYSeries::update);
+    QSignalSpy pointAddedSpy(m_series, &QXYSeries::pointAdded);
+    QSignalSpy pointsAddedSpy(m_series, &QXYSeries::pointsAdded);
+    QSignalSpy rangeReplacedSpy(m_series, &QXYSeries::pointRangeReplaced);
+    QSignalSpy pointsRemovedSpy(m_series, &QXYSeries::pointsRemoved);
+    QSignalSpy countSpy(m_series, &QXYSeries::countChanged);
+
+    QList<QPointF> points;
+    for (int i = 0; i < 100000; ++i)
+        points << QPointF(i, i);
+
+    // Appending a range emits one signal
+    m_series->appendRange(points);
+    QCOMPARE(m_series->points(), points);
+    QCOMPARE(pointAddedSpy.size(), 0);
+    QCOMPARE(pointsAddedSpy.size(), 1);
+    QCOMPARE(pointsAddedSpy.last().at(0).value<qsizetype>(), 0);
+    QCOMPARE(pointsAddedSpy.last().at(1).value<qsizetype>(), 100000);
+    QCOMPARE(countSpy.size(), 1);
+    QCOMPARE(updateSpy.size(), 1);
+
+    m_series->removeMultiple(3, m_series->count() - 3);
+    QCOMPARE(pointsRemovedSpy.size(), 1);
+    QCOMPARE(m_series->count(), 3);
+
+    // Inserting moves selected points, and invalid points are skipped
+    m_series->selectPoints({0, 2});
+    QList<QPointF> inserted = {{10, 10}, {qQNaN(), 1}, {11, 11}};
+    m_series->insertRange(1, inserted);
+    QList<QPointF> expected = {{0, 0}, {10, 10}, {11, 11}, {1, 1}, {2, 2}};
+    QCOMPARE(m_series->points(), expected);
+    QCOMPARE(pointsAddedSpy.size(), 2);
+    QCOMPARE(pointsAddedSpy.last().at(0).value<qsizetype>(), 1);
+    QCOMPARE(pointsAddedSpy.last().at(1).value<qsizetype>(), 2);
+    QVERIFY(m_series->isPointSelected(0));
+    QVERIFY(m_series->isPointSelected(4));
+    QCOMPARE(m_series->selectedPoints().size(), 2);
+
+    // Replacing a range
+    QList<QPointF> replacement = {{20, 20}, {21, 21}};
+    m_series->replaceRange(1, replacement);
+    expected = {{0, 0}, {20, 20}, {21, 21}, {1, 1}, {2, 2}};
+    QCOMPARE(m_series->points(), expected);
+    QCOMPARE(rangeReplacedSpy.size(), 1);
+    QCOMPARE(rangeReplacedSpy.last().at(0).value<qsizetype>(), 1);
+    QCOMPARE(rangeReplacedSpy.last().at(1).value<qsizetype>(), 2);
+
+    // Ranges that do not fit are ignored
+    m_series->replaceRange(4, replacement);
+    m_series->removeMultiple(4, 2);
+    QCOMPARE(m_series->points(), expected);
+    QCOMPARE(rangeReplacedSpy.size(), 1);
+    QCOMPARE(pointsRemovedSpy.size(), 1);
+
+    // Removing a range
+    m_series->removeMultiple(1, 2);
+    expected = {{0, 0}, {1, 1}, {2, 2}};
+    QCOMPARE(m_series->points(), expected);
+    QCOMPARE(pointsRemovedSpy.size(), 2);
+    QCOMPARE(m_series->selectedPoints().size(), 2);
+    QVERIFY(m_series->isPointSelected(2));
+
+    // Appending past the capacity advances the window instead
+    QSignalSpy windowSpy(m_series, &QXYSeries::windowAdvanced);
+    m_series->setCapacity(4);
+    QList<QPointF> appended = {{3, 3}, {4, 4}};
+    m_series->appendRange(appended);
+    expected = {{1, 1}, {2, 2}, {3, 3}, {4, 4}};
+    QCOMPARE(m_series->points(), expected);
+    QCOMPARE(windowSpy.size(), 1);
+    QCOMPARE(pointsAddedSpy.size(), 2);
+}
+
+void tst_xyseries::pointsSpan()
+{
+    QVERIFY(m_series);
+    QVERIFY(m_series->pointsSpan().isEmpty());
+
+    QList<QPointF> points = {{1, 4}, {9, 2}, {3, 7}};
+    m_series->append(points);
+
+    const QSpan<const QPointF> span = m_series->pointsSpan();
+    QCOMPARE(span.size(), points.size());
+    for (qsizetype i = 0; i < points.size(); ++i)
+        QCOMPARE(span[i], points[i]);
+
+    // The view refers to the series storage
+    QCOMPARE(span.data(), m_series->pointsSpan().data());
+}
+
+void tst_xyseries::rangeFromOwnPoints()
+{
+    QVERIFY(m_series);
+
+    QList<QPointF> points = {{0, 0}, {1, 1}, {2, 2}};
+    m_series->append(points);
+
+    // The lists share their storage with the series
+    m_series->appendRange(m_series->points());
+    QList<QPointF> expected = {{0, 0}, {1, 1}, {2, 2}, {0, 0}, {1, 1}, {2, 2}};
+    QCOMPARE(m_series->points(), expected);
+
+    m_series->insertRange(1, m_series->points().mid(0, 2));
+    expected = {{0, 0}, {0, 0}, {1, 1}, {1, 1}, {2, 2}, {0, 0}, {1, 1}, {2, 2}};
+    QCOMPARE(m_series->points(), expected);
+
+    m_series->append(m_series->points());
+    QCOMPARE(m_series->count(), 16);
+    QCOMPARE(m_series->points().mid(8), expected);
+
+    m_series->replaceRange(1, m_series->points().mid(0, 4));
+    QCOMPARE(m_series->points().mid(0, 5),
+             QList<QPointF>({{0, 0}, {0, 0}, {0, 0}, {1, 1}, {1, 1}}));
+}
+
 QTEST_MAIN(tst_xyseries)
 #include "tst_xyseries.moc"
@@ -74,6 +74,24 @@ Item {
         id: insertSeries
     }
 
+    GraphsView {
+        id: coalescing
+        height: top.height
+        width: top.width
+
+        axisX: ValueAxis {
+            max: 100
+        }
+
+        axisY: ValueAxis {
+            max: 100
+        }
+
+        LineSeries {
+            id: streamingSeries
+        }
+    }
+
     TestCase {
         name: "GraphsView Initial"
 
@@ -91,6 +109,8 @@ Item {
             compare(initial.seriesList, [])
             compare(initial.axisX, null)
             compare(initial.axisY, null)
+            compare(initial.maxUpdateRate, 0)
+            compare(initial.coalescedUpdateCount, 0)
             // compare some of the contents of the initial theme, as theme itself cannot be
             compare(initial.theme.theme, GraphsTheme.Theme.QtGreen)
             compare(initial.theme.colorScheme, GraphsTheme.ColorScheme.Automatic)
@@ -358,4 +378,73 @@ Item {
             signalName: "orientationChanged"
         }
     }
+
+    TestCase {
+        name: "GraphsView Update Coalescing"
+
+        function test_1_coalesce_series_updates() {
+            waitForRendering(top)
+            coalescing.resetCoalescedUpdateCount()
+            compare(coalescing.coalescedUpdateCount, 0)
+
+            for (let i = 0; i < 10; ++i)
+                streamingSeries.append(i, i)
+
+            waitForRendering(top)
+
+            compare(streamingSeries.count, 10)
+            verify(coalescing.coalescedUpdateCount >= 9)
+
+            coalescing.resetCoalescedUpdateCount()
+            compare(coalescing.coalescedUpdateCount, 0)
+        }
+
+        function test_2_max_update_rate() {
+            waitForRendering(top)
+            coalescing.resetCoalescedUpdateCount()
+            coalescedSpy.clear()
+
+            // Two seconds between passes keeps the pass for the first change pending
+            coalescing.maxUpdateRate = 0.5
+            compare(coalescing.maxUpdateRate, 0.5)
+            compare(maxUpdateRateSpy.count, 1)
+
+            for (let i = 10; i < 20; ++i)
+                streamingSeries.append(i, i)
+
+            // Only the first change scheduled a pass
+            compare(coalescing.coalescedUpdateCount, 9)
+            compare(streamingSeries.count, 20)
+
+            // Removing the limit applies the pending pass right away
+            coalescing.maxUpdateRate = -1
+            compare(coalescing.maxUpdateRate, 0)
+            compare(maxUpdateRateSpy.count, 2)
+            coalescing.ensurePolished()
+            compare(coalescedSpy.count, 1)
+
+            // After the pass, the next change schedules a new one
+            streamingSeries.append(20, 20)
+            compare(coalescing.coalescedUpdateCount, 9)
+            streamingSeries.append(21, 21)
+            compare(coalescing.coalescedUpdateCount, 10)
+            coalescing.ensurePolished()
+            compare(coalescedSpy.count, 2)
+
+            coalescing.resetCoalescedUpdateCount()
+            compare(coalescing.coalescedUpdateCount, 0)
+        }
+
+        SignalSpy {
+            id: coalescedSpy
+            target: coalescing
+            signalName: "coalescedUpdateCountChanged"
+        }
+
+        SignalSpy {
+            id: maxUpdateRateSpy
+            target: coalescing
+            signalName: "maxUpdateRateChanged"
+        }
+    }
 }
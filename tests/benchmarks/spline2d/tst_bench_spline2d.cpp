@@ -0,0 +1,112 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtGraphs/QSplineSeries>
+#include <QtTest/QtTest>
+
+// Control points are only kept up to date after the series has been completed
+class SplineSeries : public QSplineSeries
+{
+public:
+    using QSplineSeries::componentComplete;
+};
+
+class tst_bench_spline2d : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void appendPoint_data();
+    void appendPoint();
+    void replacePoint_data();
+    void replacePoint();
+    void replaceAllPoints_data();
+    void replaceAllPoints();
+
+private:
+    static QList<QPointF> createPoints(qsizetype count);
+    void addData();
+};
+
+QList<QPointF> tst_bench_spline2d::createPoints(qsizetype count)
+{
+    QList<QPointF> points;
+    points.reserve(count);
+    for (qsizetype i = 0; i < count; ++i)
+        points << QPointF(i, qSin(i * 0.1) * 10.0);
+    return points;
+}
+
+void tst_bench_spline2d::addData()
+{
+    QTest::addColumn<qsizetype>("count");
+
+    QTest::newRow("1000") << qsizetype(1000);
+    QTest::newRow("10000") << qsizetype(10000);
+    QTest::newRow("100000") << qsizetype(100000);
+}
+
+void tst_bench_spline2d::appendPoint_data()
+{
+    addData();
+}
+
+// Appending to the end re-solves only the last equations
+void tst_bench_spline2d::appendPoint()
+{
+    QFETCH(qsizetype, count);
+
+    SplineSeries series;
+    series.componentComplete();
+    series.replace(createPoints(count));
+
+    qreal x = count;
+    QBENCHMARK {
+        series.append(x, qSin(x * 0.1) * 10.0);
+        x += 1.0;
+    }
+}
+
+void tst_bench_spline2d::replacePoint_data()
+{
+    addData();
+}
+
+// Replacing a point re-solves only the equations around it
+void tst_bench_spline2d::replacePoint()
+{
+    QFETCH(qsizetype, count);
+
+    SplineSeries series;
+    series.componentComplete();
+    series.replace(createPoints(count));
+
+    const qsizetype index = count / 2;
+    qreal y = 0;
+    QBENCHMARK {
+        series.replace(index, QPointF(index, y));
+        y += 0.5;
+    }
+}
+
+void tst_bench_spline2d::replaceAllPoints_data()
+{
+    addData();
+}
+
+// Replacing all points solves the full system, which is also the fallback path
+void tst_bench_spline2d::replaceAllPoints()
+{
+    QFETCH(qsizetype, count);
+
+    SplineSeries series;
+    series.componentComplete();
+    const QList<QPointF> points = createPoints(count);
+
+    QBENCHMARK {
+        series.replace(points);
+    }
+}
+
+QTEST_MAIN(tst_bench_spline2d)
+#include "tst_bench_spline2d.moc"
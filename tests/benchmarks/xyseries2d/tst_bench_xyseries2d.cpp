@@ -0,0 +1,117 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtGraphs/QGraphsTheme>
+#include <QtGraphs/QLineSeries>
+#include <QtGraphs/QValueAxis>
+#include <QtGraphs/private/pointrenderer_p.h>
+#include <QtGraphs/private/qgraphsview_p.h>
+#include <QtTest/QtTest>
+
+class tst_bench_xyseries2d : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void appendToWindow_data();
+    void appendToWindow();
+    void appendToWindowWhileJobRuns_data();
+    void appendToWindowWhileJobRuns();
+
+private:
+    static QList<QPointF> createPoints(qsizetype count);
+    void addData();
+};
+
+QList<QPointF> tst_bench_xyseries2d::createPoints(qsizetype count)
+{
+    QList<QPointF> points;
+    points.reserve(count);
+    for (qsizetype i = 0; i < count; ++i)
+        points << QPointF(i, qSin(i * 0.1) * 10.0);
+    return points;
+}
+
+void tst_bench_xyseries2d::addData()
+{
+    QTest::addColumn<qsizetype>("count");
+
+    QTest::newRow("10000") << qsizetype(10000);
+    QTest::newRow("100000") << qsizetype(100000);
+    QTest::newRow("1000000") << qsizetype(1000000);
+}
+
+void tst_bench_xyseries2d::appendToWindow_data()
+{
+    addData();
+}
+
+// Appending to a full window drops the oldest point, which should not depend on the capacity
+void tst_bench_xyseries2d::appendToWindow()
+{
+    QFETCH(qsizetype, count);
+
+    QLineSeries series;
+    series.setCapacity(count);
+    series.replace(createPoints(count));
+
+    qreal x = count;
+    QBENCHMARK {
+        series.append(x, qSin(x * 0.1) * 10.0);
+        x += 1.0;
+    }
+}
+
+void tst_bench_xyseries2d::appendToWindowWhileJobRuns_data()
+{
+    addData();
+}
+
+// The same while a geometry job of the series is running. The job must not share the points
+// with the series, or each append would copy the whole window.
+void tst_bench_xyseries2d::appendToWindowWhileJobRuns()
+{
+    QFETCH(qsizetype, count);
+
+    QGraphsView view;
+    view.setSize(QSizeF(800, 600));
+    view.setTheme(new QGraphsTheme(&view));
+    auto axisX = new QValueAxis(&view);
+    axisX->setRange(0, count);
+    auto axisY = new QValueAxis(&view);
+    axisY->setRange(-10, 10);
+    view.setAxisX(axisX);
+    view.setAxisY(axisY);
+
+    auto series = new QLineSeries(&view);
+    series->setCapacity(count);
+    series->replace(createPoints(count));
+    // Reserves the storage of the window
+    qreal x = count;
+    series->append(x, qSin(x * 0.1) * 10.0);
+    x += 1.0;
+    view.addSeries(series);
+    view.ensurePolished();
+
+    // The job finishes on the event loop, which is not run here
+    PointRenderer *renderer = view.m_pointRenderer;
+    QVERIFY(renderer);
+    auto group = renderer->m_groups.value(series);
+    QVERIFY(group);
+    QVERIFY(group->geometryJob);
+
+    // Without a detach, dropping the oldest point only moves the start of the same storage
+    const QPointF *data = series->points().constData();
+    series->append(x, qSin(x * 0.1) * 10.0);
+    x += 1.0;
+    QCOMPARE(series->points().constData(), data + 1);
+
+    QBENCHMARK {
+        series->append(x, qSin(x * 0.1) * 10.0);
+        x += 1.0;
+    }
+    QVERIFY(group->geometryJob);
+}
+
+QTEST_MAIN(tst_bench_xyseries2d)
+#include "tst_bench_xyseries2d.moc"